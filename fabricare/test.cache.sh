@@ -0,0 +1,54 @@
+#!/bin/sh
+# Created by Grigore Stefan <g_stefan@yahoo.com>
+# Public domain (Unlicense) <http://unlicense.org>
+# SPDX-FileCopyrightText: 2022-2026 Grigore Stefan <g_stefan@yahoo.com>
+# SPDX-License-Identifier: Unlicense
+
+# Build twice with a compile cache, removing the temp folder and the
+# output in between, the second build must restore every object and
+# the link from the cache
+# usage: test.cache.sh xyo-cc output-file arguments...
+
+XYOCC="$1"
+OUTPUT="$2"
+shift 2
+TEMP=temp/test-cache
+CACHE=temp/test-cache.cache
+
+rm -rf "$TEMP" "$CACHE"
+"$XYOCC" "$@" --temp-path=$TEMP --cache-path=$CACHE || exit 1
+if [ ! -f "$OUTPUT" ]; then
+	echo "Error: file not found $OUTPUT"
+	exit 1
+fi
+rm -rf "$TEMP"
+rm -f "$OUTPUT"
+
+LOG=$(mktemp)
+trap 'rm -f "$LOG"' EXIT
+if ! "$XYOCC" "$@" --temp-path=$TEMP --cache-path=$CACHE >"$LOG"; then
+	cat "$LOG"
+	exit 1
+fi
+
+STATS=$(grep "^\[cache\]" "$LOG")
+echo "$STATS"
+HITS=$(echo "$STATS" | sed -n 's/^\[cache\] hits \([0-9]*\).*/\1/p')
+MISSES=$(echo "$STATS" | sed -n 's/.* misses \([0-9]*\), link hits.*/\1/p')
+LINK_HITS=$(echo "$STATS" | sed -n 's/.*link hits \([0-9]*\).*/\1/p')
+
+RETV=0
+if [ "${HITS:-0}" -eq 0 ] || [ "${MISSES:-1}" -ne 0 ]; then
+	echo "Error: objects not restored from cache"
+	RETV=1
+fi
+if [ "${LINK_HITS:-0}" -eq 0 ]; then
+	echo "Error: link not restored from cache"
+	RETV=1
+fi
+if [ ! -f "$OUTPUT" ]; then
+	echo "Error: file not found $OUTPUT"
+	RETV=1
+fi
+
+exit $RETV
@@ -0,0 +1,46 @@
+#!/bin/sh
+# Created by Grigore Stefan <g_stefan@yahoo.com>
+# Public domain (Unlicense) <http://unlicense.org>
+# SPDX-FileCopyrightText: 2022-2026 Grigore Stefan <g_stefan@yahoo.com>
+# SPDX-License-Identifier: Unlicense
+
+# Check that every PT_LOAD segment of an ELF file is aligned to 2 MiB
+# and that the executable segment starts on a 2 MiB boundary
+
+HUGEPAGE=2097152
+
+if [ ! -f "$1" ]; then
+	echo "Error: file not found $1"
+	exit 1
+fi
+
+SEGMENTS=$(mktemp)
+trap 'rm -f "$SEGMENTS"' EXIT
+readelf -lW "$1" | grep "^ *LOAD" >"$SEGMENTS"
+
+RETV=0
+TEXT=0
+while read -r TYPE OFFSET VADDR PADDR FILESZ MEMSZ REST; do
+	ALIGN=${REST##* }
+	FLAGS=${REST% *}
+	if [ $((ALIGN)) -lt $HUGEPAGE ]; then
+		echo "Error: segment at $VADDR aligned to $ALIGN"
+		RETV=1
+	fi
+	case "$FLAGS" in
+	*E*)
+		TEXT=1
+		if [ $((OFFSET % HUGEPAGE)) -ne 0 ] || [ $((VADDR % HUGEPAGE)) -ne 0 ]; then
+			echo "Error: text segment at $VADDR (offset $OFFSET) not on a 2 MiB boundary"
+			RETV=1
+		fi
+		;;
+	esac
+done <"$SEGMENTS"
+
+if [ $TEXT -eq 0 ]; then
+	echo "Error: no executable segment in $1"
+	RETV=1
+fi
+
+exit $RETV
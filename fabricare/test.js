@@ -1,14 +1,21 @@
-// Created by Grigore Stefan <g_stefan@yahoo.com>
-// Public domain (Unlicense) <http://unlicense.org>
-// SPDX-FileCopyrightText: 2022-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: Unlicense
-
-messageAction("test");
-
-Shell.mkdirRecursivelyIfNotExists("output/test");
-Shell.mkdirRecursivelyIfNotExists("temp");
-
-// ---
-
-exitIf(Shell.execute("output/bin/xyo-cc @input/xyo-cc-x.compile.arguments --output-bin-path=output/test"));
-exitIf(Shell.execute("output/bin/xyo-cc @input/xyo-cc-y.compile.json --output-bin-path=output/test"));
+// Created by Grigore Stefan <g_stefan@yahoo.com>
+// Public domain (Unlicense) <http://unlicense.org>
+// SPDX-FileCopyrightText: 2022-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: Unlicense
+
+messageAction("test");
+
+Shell.mkdirRecursivelyIfNotExists("output/test");
+Shell.mkdirRecursivelyIfNotExists("temp");
+
+// ---
+
+exitIf(Shell.execute("output/bin/xyo-cc @input/xyo-cc-x.compile.arguments --output-bin-path=output/test"));
+exitIf(Shell.execute("output/bin/xyo-cc @input/xyo-cc-y.compile.json --output-bin-path=output/test"));
+
+if (!OS.isWindows()) {
+	exitIf(Shell.execute("output/bin/xyo-cc @input/xyo-cc-x.compile.arguments --project=xyo-cc-h --hugepage-text --output-bin-path=output/test"));
+	exitIf(Shell.execute("sh fabricare/test.hugepage.sh output/test/xyo-cc-h"));
+	exitIf(Shell.execute("sh fabricare/test.cache.sh output/bin/xyo-cc output/test/xyo-cc-c @input/xyo-cc-x.compile.arguments --project=xyo-cc-c --output-bin-path=output/test"));
+	exitIf(Shell.execute("sh fabricare/test.remote-cache.sh output/bin/xyo-cc output/test/xyo-cc-r @input/xyo-cc-x.compile.arguments --project=xyo-cc-r --output-bin-path=output/test"));
+};
@@ -0,0 +1,73 @@
+#!/bin/sh
+# Created by Grigore Stefan <g_stefan@yahoo.com>
+# Public domain (Unlicense) <http://unlicense.org>
+# SPDX-FileCopyrightText: 2022-2026 Grigore Stefan <g_stefan@yahoo.com>
+# SPDX-License-Identifier: Unlicense
+
+# Round trip through the stand-in cache server: build and upload, clear
+# the local cache, build again, every entry must come from the server
+# usage: test.remote-cache.sh xyo-cc output-file arguments...
+
+XYOCC="$1"
+OUTPUT="$2"
+shift 2
+PORT=47613
+TEMP=temp/test-remote-cache
+SERVER=temp/test-remote-cache.server
+CACHE=temp/test-remote-cache.cache
+URL=http://127.0.0.1:$PORT
+
+rm -rf "$TEMP" "$SERVER" "$CACHE"
+"$XYOCC" --cache-server=$PORT --cache-path=$SERVER >/dev/null &
+SERVER_PID=$!
+LOG=$(mktemp)
+trap 'kill $SERVER_PID 2>/dev/null; rm -f "$LOG"' EXIT
+
+COUNT=0
+while ! curl -s -o /dev/null "$URL/ac/0"; do
+	COUNT=$((COUNT + 1))
+	if [ $COUNT -ge 50 ]; then
+		echo "Error: cache server not started"
+		exit 1
+	fi
+	sleep 0.1
+done
+
+"$XYOCC" "$@" --temp-path=$TEMP --cache-path=$CACHE --remote-cache=$URL || exit 1
+
+# Uploads run in background, wait until the server has all the entries
+ENTRIES=$(find "$CACHE" -name "*.ac" | wc -l)
+COUNT=0
+while [ "$(find "$SERVER/ac" -type f 2>/dev/null | wc -l)" -lt "$ENTRIES" ]; do
+	COUNT=$((COUNT + 1))
+	if [ $COUNT -ge 300 ]; then
+		echo "Error: entries not uploaded to cache server"
+		exit 1
+	fi
+	sleep 0.1
+done
+
+rm -rf "$TEMP" "$CACHE"
+rm -f "$OUTPUT"
+
+if ! "$XYOCC" "$@" --temp-path=$TEMP --cache-path=$CACHE --remote-cache=$URL >"$LOG"; then
+	cat "$LOG"
+	exit 1
+fi
+
+STATS=$(grep "^\[remote-cache\]" "$LOG")
+echo "$STATS"
+HITS=$(echo "$STATS" | sed -n 's/.*remote hits \([0-9]*\).*/\1/p')
+MISSES=$(echo "$STATS" | sed -n 's/.* misses \([0-9]*\).*/\1/p')
+
+RETV=0
+if [ "${HITS:-0}" -eq 0 ] || [ "${MISSES:-1}" -ne 0 ]; then
+	echo "Error: entries not fetched from cache server"
+	RETV=1
+fi
+if [ ! -f "$OUTPUT" ]; then
+	echo "Error: file not found $OUTPUT"
+	RETV=1
+fi
+
+exit $RETV
@@ -1,15 +1,29 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#include <XYO/CPPCompilerCommandDriver.hpp>
-#include <XYO/CPPCompilerCommandDriver/Copyright.cpp>
-#include <XYO/CPPCompilerCommandDriver/License.cpp>
-#include <XYO/CPPCompilerCommandDriver/Version.cpp>
-
-// -
-#include <XYO/CPPCompilerCommandDriver/CompilerOptions.cpp>
-#include <XYO/CPPCompilerCommandDriver/CompilerMSVC.cpp>
-#include <XYO/CPPCompilerCommandDriver/CompilerGCC.cpp>
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver.hpp>
+#include <XYO/CPPCompilerCommandDriver/Copyright.cpp>
+#include <XYO/CPPCompilerCommandDriver/License.cpp>
+#include <XYO/CPPCompilerCommandDriver/Version.cpp>
+
+// -
+#include <XYO/CPPCompilerCommandDriver/CompilerOptions.cpp>
+#include <XYO/CPPCompilerCommandDriver/Digest.cpp>
+#include <XYO/CPPCompilerCommandDriver/DepFile.cpp>
+#include <XYO/CPPCompilerCommandDriver/FileSystem.cpp>
+#include <XYO/CPPCompilerCommandDriver/UnityBuild.cpp>
+#include <XYO/CPPCompilerCommandDriver/ModuleDependency.cpp>
+#include <XYO/CPPCompilerCommandDriver/CompileCache.cpp>
+#include <XYO/CPPCompilerCommandDriver/RemoteCache.cpp>
+#include <XYO/CPPCompilerCommandDriver/CacheServer.cpp>
+#include <XYO/CPPCompilerCommandDriver/BuildHistory.cpp>
+#include <XYO/CPPCompilerCommandDriver/JobServer.cpp>
+#include <XYO/CPPCompilerCommandDriver/Process.cpp>
+#include <XYO/CPPCompilerCommandDriver/MemoryBudget.cpp>
+#include <XYO/CPPCompilerCommandDriver/LoadLimit.cpp>
+#include <XYO/CPPCompilerCommandDriver/BuildTrace.cpp>
+#include <XYO/CPPCompilerCommandDriver/CompilerMSVC.cpp>
+#include <XYO/CPPCompilerCommandDriver/CompilerGCC.cpp>
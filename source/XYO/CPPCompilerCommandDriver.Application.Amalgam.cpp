@@ -1,18 +1,18 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#include <XYO/CPPCompilerCommandDriver.Amalgam.cpp>
-
-// -
-
-#include <XYO/CPPCompilerCommandDriver.Application.hpp>
-#include <XYO/CPPCompilerCommandDriver.Application/Copyright.cpp>
-#include <XYO/CPPCompilerCommandDriver.Application/License.cpp>
-#include <XYO/CPPCompilerCommandDriver.Application/Version.cpp>
-
-// -
-
-#include <XYO/CPPCompilerCommandDriver.Application/Application.cpp>
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver.Amalgam.cpp>
+
+// -
+
+#include <XYO/CPPCompilerCommandDriver.Application.hpp>
+#include <XYO/CPPCompilerCommandDriver.Application/Copyright.cpp>
+#include <XYO/CPPCompilerCommandDriver.Application/License.cpp>
+#include <XYO/CPPCompilerCommandDriver.Application/Version.cpp>
+
+// -
+
+#include <XYO/CPPCompilerCommandDriver.Application/Application.cpp>
@@ -1,13 +1,13 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_APPLICATION_HPP
-#define XYO_CPPCOMPILERCOMMANDDRIVER_APPLICATION_HPP
-
-#include <XYO/CPPCompilerCommandDriver.hpp>
-#include <XYO/CPPCompilerCommandDriver.Application/Application.hpp>
-
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_APPLICATION_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_APPLICATION_HPP
+
+#include <XYO/CPPCompilerCommandDriver.hpp>
+#include <XYO/CPPCompilerCommandDriver.Application/Application.hpp>
+
 #endif
\ No newline at end of file
@@ -1,1105 +1,1913 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#include <XYO/CPPCompilerCommandDriver.hpp>
-#include <XYO/CPPCompilerCommandDriver.Application/Application.hpp>
-#include <XYO/CPPCompilerCommandDriver.Application/Copyright.hpp>
-#include <XYO/CPPCompilerCommandDriver.Application/License.hpp>
-#include <XYO/CPPCompilerCommandDriver.Application/Version.hpp>
-#include <XYO/FileJSON.hpp>
-
-namespace XYO::CPPCompilerCommandDriver::Application {
-
-	void Application::showUsage() {
-		printf("C++ Compiler Command Driver\n");
-		showVersion();
-		printf("%s\n\n", CPPCompilerCommandDriver::Application::Copyright::copyright());
-
-		printf("%s",
-		       "options:\n"
-		       "    --help                    this info\n"
-		       "    --usage                   this info\n"
-		       "    --license                 show license\n"
-		       "    --version                 show version\n"
-		       "    --project=name            project name\n"
-		       "    --platform=name           platform name\n"
-		       "    --debug                   build debug version\n"
-		       "    --release                 build release version\n"
-		       "    --exe                     build executable (.exe)\n"
-		       "    --lib                     build library (.lib)\n"
-		       "    --dll                     build dynamic library (.dll)\n"
-		       "    --dll-x-static            build dynamic library with static linking (.dll)\n"
-		       "    --crt-dynamic             build using dynamic crt (default for dll)\n"
-		       "    --crt-static              build using static crt (default for lib)\n"
-		       "    --threads=count           specify number of threads to use\n"
-		       "    --def=value               add value to definitions\n"
-		       "    --inc=path                add path to include in search\n"
-		       "    --src-h=file              add file as h source\n"
-		       "    --src-c=file              add file as c source\n"
-		       "    --src-hpp=file            add file as hpp source\n"
-		       "    --src-cpp=file            add file as cpp source\n"
-		       "    --use-lib-path=path       add path to library search\n"
-		       "    --use-lib=library         add library to linker\n"
-		       "    --def-file=file           use file for linker definitions (.dll)\n"
-		       "    --rc-inc=path             add path to resource compiler include\n"
-		       "    --rc-def=value            add value to resource compiler definitions\n"
-		       "    --rc-src=file             add file as rc source\n"
-		       "    --source-path=path        folder where source files (.hpp/.h/.cpp/.c) are stored, default ./\n"
-		       "    --output-path=path        location to output folder, default ./\n"
-		       "    --temp-path=path          location to temp folder, default to ./temp\n"
-		       "    --output-bin-path=path    location to output bin folder, default to ./output\n"
-		       "    --output-lib-path=path    location to output lib folder, default to ./output\n"
-		       "    --lib-name=name           use name for static library\n"
-		       "    --lib-version=version     library name use version\n"
-		       "    --force-make              force build all\n"
-		       "    --no-lib                  do not generate library files (.lib), when build dll\n"
-		       "    --platform-compiler-msvc  use msvc compiler\n"
-		       "    --platform-compiler-gcc   use gcc compiler\n"
-		       "    --platform-64bit          compile for 64bit\n"
-		       "    --platform-32bit          compile for 32bit\n"
-		       "    --platform-os-linux       platform os is linux\n"
-		       "    --platform-os-windows     platform os is windows\n"
-		       "    --platform-os-emscripten  platform os is emscripten\n");
-		printf("\n");
-	};
-
-	void Application::showLicense() {
-		printf("%s", CPPCompilerCommandDriver::Application::License::license().c_str());
-	};
-
-	void Application::showVersion() {
-		printf("version %s build %s [%s]\n", CPPCompilerCommandDriver::Application::Version::version(), CPPCompilerCommandDriver::Application::Version::build(), CPPCompilerCommandDriver::Application::Version::datetime());
-	};
-
-	void Application::initMemory() {
-		String::initMemory();
-		TDynamicArray<String>::initMemory();
-	};
-
-	int Application::main(int cmdN, char *cmdS[]) {
-		int i;
-		String opt;
-		size_t optIndex;
-		String optValue;
-		TDynamicArray<String> cmdLine;
-
-		// ---
-
-		String projectName = "project";
-		int crtOption = CompilerOptions::CRTDynamic;
-		int dllOption = CompilerOptions::None;
-
-		bool makeExecutable = false;
-		bool makeLibrary = false;
-		bool makeDynamicLibrary = false;
-		bool isRelease = true;
-
-		int numThreads = Processor::getCount();
-		TDynamicArray<String> cppDefine;
-		TDynamicArray<String> incPath;
-		TDynamicArray<String> srcH;
-		TDynamicArray<String> srcC;
-		TDynamicArray<String> srcHpp;
-		TDynamicArray<String> srcCpp;
-		TDynamicArray<String> libDependencyPath;
-		TDynamicArray<String> libDependency;
-		String defFile;
-
-		TDynamicArray<String> rcDefine;
-		TDynamicArray<String> incPathRC;
-		TDynamicArray<String> srcRc;
-
-		String sourcePath = ".";
-		String outputPath = ".";
-		String tempPath = "./temp";
-		String outputBinPath = outputPath;
-		String outputLibPath = outputPath;
-		String libName;
-		String libVersion;
-		String platformName = XYO_PLATFORM_NAME;
-
-		bool optPlatformCompilerMSVC = false;
-		bool optPlatformCompilerGCC = false;
-		bool optPlatform64bit = false;
-		bool optPlatform32bit = false;
-		bool optPlatformOSLinux = false;
-		bool optPlatformOSWindows = false;
-		bool optPlatformOSEmscripten = false;
-
-		bool forceMake = false;
-		bool noLib = false;
-
-		// ---
-
-#ifdef XYO_PLATFORM_COMPILER_MSVC
-		optPlatformCompilerMSVC = true;
-#endif
-#ifdef XYO_PLATFORM_COMPILER_GCC
-		optPlatformCompilerGCC = true;
-#endif
-
-#ifdef XYO_PLATFORM_64BIT
-		optPlatform64bit = true;
-#endif
-#ifdef XYO_PLATFORM_32BIT
-		optPlatform32bit = true;
-#endif
-
-#ifdef XYO_PLATFORM_OS_LINUX
-		optPlatformOSLinux = true;
-#endif
-#ifdef XYO_PLATFORM_OS_WINDOWS
-		optPlatformOSWindows = true;
-#endif
-#ifdef XYO_PLATFORM_OS_EMSCRIPTEN
-		optPlatformOSEmscripten = true;
-#endif
-
-		if (Shell::hasEnv("XYO_PLATFORM_COMPILER_MSVC")) {
-			optPlatformCompilerMSVC = true;
-		};
-		if (Shell::hasEnv("XYO_PLATFORM_COMPILER_GCC")) {
-			optPlatformCompilerGCC = true;
-		};
-		if (Shell::hasEnv("XYO_PLATFORM_64BIT")) {
-			optPlatform64bit = true;
-		};
-		if (Shell::hasEnv("XYO_PLATFORM_32BIT")) {
-			optPlatform32bit = true;
-		};
-		if (Shell::hasEnv("XYO_PLATFORM_OS_LINUX")) {
-			optPlatformOSLinux = true;
-		};
-		if (Shell::hasEnv("XYO_PLATFORM_OS_WINDOWS")) {
-			optPlatformOSWindows = true;
-		};
-		if (Shell::hasEnv("XYO_PLATFORM_OS_EMSCRIPTEN")) {
-			optPlatformOSEmscripten = true;
-		};
-
-		// ---
-
-		if (Shell::hasEnv("XYO_PLATFORM_COMPILE_DEBUG")) {
-			String env = Shell::getEnv("XYO_PLATFORM_COMPILE_DEBUG");
-			if (env == "1" || env == "ON" || env == "TRUE") {
-				isRelease = false;
-			};
-		};
-
-		if (Shell::hasEnv("XYO_PLATFORM_COMPILE_CRT_STATIC")) {
-			String env = Shell::getEnv("XYO_PLATFORM_COMPILE_CRT_STATIC");
-			if (env == "1" || env == "ON" || env == "TRUE") {
-				crtOption = CompilerOptions::CRTStatic;
-			};
-		};
-
-		Shell::getEnv("XYO_PLATFORM_COMPILE_DEFINE").explode(" ", cppDefine);
-
-		// ---
-
-		for (i = 1; i < cmdN; ++i) {
-			if (StringCore::beginWith(cmdS[i], "@")) {
-				String content;
-				if (StringCore::endsWith(cmdS[i], ".json")) {
-					TPointer<FileJSON::Value> json;
-					if (!FileJSON::load(&cmdS[i][1], json)) {
-						printf("Error: json file load - %s\n", &cmdS[i][1]);
-						return 1;
-					};
-					FileJSON::VAssociativeArray *jsonInfo = TDynamicCast<FileJSON::VAssociativeArray *>(json);
-					if (!jsonInfo) {
-						printf("Error: json no info - %s\n", &cmdS[i][1]);
-						return 1;
-					};
-					int k, m, j;
-					String key;
-					FileJSON::Value *item;
-					FileJSON::VString *vString;
-					FileJSON::VArray *vArray;
-					FileJSON::VAssociativeArray *vAssociativeArray;
-					for (k = 0; k < jsonInfo->value->length(); ++k) {
-						key = jsonInfo->value->arrayKey->index(k);
-						item = jsonInfo->value->arrayValue->index(k);
-						if (key == "project") {
-							vString = TDynamicCast<FileJSON::VString *>(item);
-							if (vString) {
-								cmdLine.push(String("--project=") + vString->value);
-								continue;
-							};
-							printf("Error: json syntax - project - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-						if (key == "type") {
-							vString = TDynamicCast<FileJSON::VString *>(item);
-							if (vString) {
-								cmdLine.push(String("--") + vString->value);
-								continue;
-							};
-							printf("Error: json syntax - type - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-						if (key == "defines") {
-							vArray = TDynamicCast<FileJSON::VArray *>(item);
-							if (vArray) {
-								for (m = 0; m < vArray->value->length(); ++m) {
-									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
-									if (vString) {
-										cmdLine.push(String("--def=") + vString->value);
-										continue;
-									};
-									printf("Error: json syntax - defines/items -  %s\n", &cmdS[i][1]);
-									return 1;
-								};
-								continue;
-							};
-							printf("Error: json syntax - defines - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-						if (key == "includePath") {
-							vArray = TDynamicCast<FileJSON::VArray *>(item);
-							if (vArray) {
-								for (m = 0; m < vArray->value->length(); ++m) {
-									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
-									if (vString) {
-										cmdLine.push(String("--inc=") + vString->value);
-										continue;
-									};
-									printf("Error: json syntax - includePath/items - %s\n", &cmdS[i][1]);
-									return 1;
-								};
-								continue;
-							};
-							printf("Error: json syntax - includePath - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-						if (key == "hSource") {
-							vArray = TDynamicCast<FileJSON::VArray *>(item);
-							if (vArray) {
-								for (m = 0; m < vArray->value->length(); ++m) {
-									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
-									if (vString) {
-										cmdLine.push(String("--src-h=") + vString->value);
-										continue;
-									};
-									printf("Error: json syntax - hSource/items - %s\n", &cmdS[i][1]);
-									return 1;
-								};
-								continue;
-							};
-							printf("Error: json syntax - hSource - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-						if (key == "cSource") {
-							vArray = TDynamicCast<FileJSON::VArray *>(item);
-							if (vArray) {
-								for (m = 0; m < vArray->value->length(); ++m) {
-									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
-									if (vString) {
-										cmdLine.push(String("--src-c=") + vString->value);
-										continue;
-									};
-									printf("Error: json syntax - cSource/items - %s\n", &cmdS[i][1]);
-									return 1;
-								};
-								continue;
-							};
-							printf("Error: json syntax - cSource - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-						if (key == "hppSource") {
-							vArray = TDynamicCast<FileJSON::VArray *>(item);
-							if (vArray) {
-								for (m = 0; m < vArray->value->length(); ++m) {
-									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
-									if (vString) {
-										cmdLine.push(String("--src-hpp=") + vString->value);
-										continue;
-									};
-									printf("Error: json syntax - hppSource/items - %s\n", &cmdS[i][1]);
-									return 1;
-								};
-								continue;
-							};
-							printf("Error: json syntax - hppSource - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-						if (key == "cppSource") {
-							vArray = TDynamicCast<FileJSON::VArray *>(item);
-							if (vArray) {
-								for (m = 0; m < vArray->value->length(); ++m) {
-									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
-									if (vString) {
-										cmdLine.push(String("--src-cpp=") + vString->value);
-										continue;
-									};
-									printf("Error: json syntax - cppSource/items - %s\n", &cmdS[i][1]);
-									return 1;
-								};
-								continue;
-							};
-							printf("Error: json syntax - cppSource - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-						if (key == "resources") {
-							vAssociativeArray = TDynamicCast<FileJSON::VAssociativeArray *>(item);
-							if (vAssociativeArray) {
-								String vKey;
-								FileJSON::Value *vItem;
-								for (j = 0; j < vAssociativeArray->value->length(); ++j) {
-									vKey = vAssociativeArray->value->arrayKey->index(j);
-									vItem = vAssociativeArray->value->arrayValue->index(j);
-									if (vKey == "defines") {
-										vArray = TDynamicCast<FileJSON::VArray *>(vItem);
-										if (vArray) {
-											for (m = 0; m < vArray->value->length(); ++m) {
-												vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
-												if (vString) {
-													cmdLine.push(String("--rc-def=") + vString->value);
-													continue;
-												};
-												printf("Error: json syntax - resources - defines/items - %s\n", &cmdS[i][1]);
-												return 1;
-											};
-											continue;
-										};
-										printf("Error: json syntax - resources - defines - %s\n", &cmdS[i][1]);
-										return 1;
-									};
-									if (vKey == "includePath") {
-										vArray = TDynamicCast<FileJSON::VArray *>(vItem);
-										if (vArray) {
-											for (m = 0; m < vArray->value->length(); ++m) {
-												vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
-												if (vString) {
-													cmdLine.push(String("--rc-inc=") + vString->value);
-													continue;
-												};
-												printf("Error: json syntax - resources - includePath/items - %s\n", &cmdS[i][1]);
-												return 1;
-											};
-											continue;
-										};
-										printf("Error: json syntax - resources - includePath - %s\n", &cmdS[i][1]);
-										return 1;
-									};
-									if (vKey == "rcSource") {
-										vArray = TDynamicCast<FileJSON::VArray *>(vItem);
-										if (vArray) {
-											for (m = 0; m < vArray->value->length(); ++m) {
-												vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
-												if (vString) {
-													cmdLine.push(String("--rc-src=") + vString->value);
-													continue;
-												};
-												printf("Error: json syntax - resources - rcSource/items - %s\n", &cmdS[i][1]);
-												return 1;
-											};
-											continue;
-										};
-										printf("Error: json syntax - resources - rcSource - %s\n", &cmdS[i][1]);
-										return 1;
-									};
-									printf("Error: json syntax - resources/items - %s\n", &cmdS[i][1]);
-									return 1;
-								};
-								continue;
-							};
-							printf("Error: json syntax - resources - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-						if (key == "crt") {
-							vString = TDynamicCast<FileJSON::VString *>(item);
-							if (vString) {
-								cmdLine.push(String("--crt-") + vString->value);
-								continue;
-							};
-							printf("Error: json syntax - crt - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-						if (key == "libraryPath") {
-							vArray = TDynamicCast<FileJSON::VArray *>(item);
-							if (vArray) {
-								for (m = 0; m < vArray->value->length(); ++m) {
-									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
-									if (vString) {
-										cmdLine.push(String("--use-lib-path=") + vString->value);
-										continue;
-									};
-									printf("Error: json syntax - libraryPath/items - %s\n", &cmdS[i][1]);
-									return 1;
-								};
-								continue;
-							};
-							printf("Error: json syntax - libraryPath - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-						if (key == "library") {
-							vArray = TDynamicCast<FileJSON::VArray *>(item);
-							if (vArray) {
-								for (m = 0; m < vArray->value->length(); ++m) {
-									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
-									if (vString) {
-										cmdLine.push(String("--use-lib=") + vString->value);
-										continue;
-									};
-									printf("Error: json syntax - library/items - %s\n", &cmdS[i][1]);
-									return 1;
-								};
-								continue;
-							};
-							printf("Error: json syntax - library - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-						if (key == "linkerDefinitionsFile") {
-							vString = TDynamicCast<FileJSON::VString *>(item);
-							if (vString) {
-								cmdLine.push(String("--def-file=") + vString->value);
-								continue;
-							};
-							printf("Error: json syntax - linkerDefinitionsFile - %s\n", &cmdS[i][1]);
-							return 1;
-						};
-					};
-				};
-				if (Shell::fileGetContents(&cmdS[i][1], content)) {
-					XYO::System::ShellArguments shellArguments;
-					int m;
-					shellArguments.set(content);
-					for (m = 0; m < shellArguments.cmdN; ++m) {
-						cmdLine.push(shellArguments.cmdS[m]);
-					};
-					continue;
-				};
-				printf("Error: file not found - %s\n", &cmdS[i][1]);
-				return 1;
-			};
-			cmdLine.push(cmdS[i]);
-		};
-
-		for (i = 0; i < cmdLine.length(); ++i) {
-			if (StringCore::beginWith(cmdLine[i], "--")) {
-				opt = cmdLine[i].index(2);
-				optValue = "";
-				if (opt.indexOf("=", 0, optIndex)) {
-					optValue = opt.substring(optIndex + 1);
-					opt = opt.substring(0, optIndex);
-				};
-				if (opt == "help") {
-					showUsage();
-					return 0;
-				};
-				if (opt == "usage") {
-					showUsage();
-					return 0;
-				};
-				if (opt == "license") {
-					showLicense();
-					return 0;
-				};
-				if (opt == "version") {
-					showVersion();
-					return 0;
-				};
-				if (opt == "project") {
-					if (optValue.length() == 0) {
-						printf("Error: project is empty\n");
-						return 1;
-					};
-					projectName = optValue;
-					continue;
-				};
-				if (opt == "platform") {
-					if (optValue.length() == 0) {
-						printf("Error: platform is empty\n");
-						return 1;
-					};
-					platformName = optValue;
-					continue;
-				};
-				if (opt == "debug") {
-					isRelease = false;
-					continue;
-				};
-				if (opt == "release") {
-					isRelease = true;
-					continue;
-				};
-				if (opt == "exe") {
-					makeExecutable = true;
-					continue;
-				};
-				if (opt == "lib") {
-					makeLibrary = true;
-					continue;
-				};
-				if (opt == "dll") {
-					makeDynamicLibrary = true;
-					continue;
-				};
-				if (opt == "dll-x-static") {
-					makeDynamicLibrary = true;
-					dllOption = CompilerOptions::DynamicLibraryXStatic;
-					continue;
-				};
-				if (opt == "crt-dynamic") {
-					crtOption = CompilerOptions::CRTDynamic;
-					continue;
-				};
-				if (opt == "crt-static") {
-					crtOption = CompilerOptions::CRTStatic;
-					continue;
-				};
-				if (opt == "threads") {
-					if (sscanf(optValue.value(), "%d", &numThreads) != 1) {
-						numThreads = Processor::getCount();
-					};
-					continue;
-				};
-				if (opt == "def") {
-					if (optValue.isEmpty()) {
-						printf("Error: def parameter is empty\n");
-						return 1;
-					};
-					cppDefine.push(optValue);
-					continue;
-				};
-				if (opt == "inc") {
-					if (optValue.isEmpty()) {
-						printf("Error: inc path is empty\n");
-						return 1;
-					};
-					incPath.push(optValue);
-					continue;
-				};
-				if (opt == "src-h") {
-					if (optValue.isEmpty()) {
-						printf("Error: src-h file not provided\n");
-						return 1;
-					};
-					srcH.push(optValue);
-					continue;
-				};
-				if (opt == "src-c") {
-					if (optValue.isEmpty()) {
-						printf("Error: src-c file not provided\n");
-						return 1;
-					};
-					srcC.push(optValue);
-					continue;
-				};
-				if (opt == "src-hpp") {
-					if (optValue.isEmpty()) {
-						printf("Error: src-hpp file not provided\n");
-						return 1;
-					};
-					srcHpp.push(optValue);
-					continue;
-				};
-				if (opt == "src-cpp") {
-					if (optValue.isEmpty()) {
-						printf("Error: src-cpp file not provided\n");
-						return 1;
-					};
-					srcCpp.push(optValue);
-					continue;
-				};
-				if (opt == "use-lib-path") {
-					if (optValue.isEmpty()) {
-						printf("Error: use-lib-path is empty\n");
-						return 1;
-					};
-					libDependencyPath.push(optValue);
-					continue;
-				};
-				if (opt == "use-lib") {
-					if (optValue.isEmpty()) {
-						printf("Error: use-lib is empty\n");
-						return 1;
-					};
-					libDependency.push(optValue);
-					continue;
-				};
-				if (opt == "def-file") {
-					if (optValue.isEmpty()) {
-						printf("Error: def-file is empty\n");
-						return 1;
-					};
-					defFile = optValue;
-					continue;
-				};
-				if (opt == "rc-inc") {
-					if (optValue.isEmpty()) {
-						printf("Error: rc-inc path is empty\n");
-						return 1;
-					};
-					incPathRC.push(optValue);
-					continue;
-				};
-				if (opt == "rc-def") {
-					if (optValue.isEmpty()) {
-						printf("Error: rc-def parameter is empty\n");
-						return 1;
-					};
-					rcDefine.push(optValue);
-					continue;
-				};
-				if (opt == "rc-src") {
-					if (optValue.isEmpty()) {
-						printf("Error: rc-src file not provided\n");
-						return 1;
-					};
-					srcRc.push(optValue);
-					continue;
-				};
-				if (opt == "source-path") {
-					if (optValue.isEmpty()) {
-						printf("Error: source-path not provided\n");
-						return 1;
-					};
-					sourcePath = optValue;
-					continue;
-				};
-				if (opt == "output-path") {
-					if (optValue.isEmpty()) {
-						printf("Error: output-path not provided\n");
-						return 1;
-					};
-					outputPath = optValue;
-					outputBinPath = outputPath;
-					outputLibPath = outputPath;
-				};
-				if (opt == "temp-path") {
-					if (optValue.isEmpty()) {
-						printf("Error: temp-path is empty\n");
-						return 1;
-					};
-					tempPath = optValue;
-					continue;
-				};
-				if (opt == "output-bin-path") {
-					if (optValue.isEmpty()) {
-						printf("Error: output-bin-path is empty\n");
-						return 1;
-					};
-					outputBinPath = optValue;
-					continue;
-				};
-				if (opt == "output-lib-path") {
-					if (optValue.isEmpty()) {
-						printf("Error: output-lib-path is empty\n");
-						return 1;
-					};
-					outputLibPath = optValue;
-					continue;
-				};
-				if (opt == "lib-name") {
-					if (optValue.isEmpty()) {
-						printf("Error: lib-name is empty\n");
-						return 1;
-					};
-					libName = optValue;
-					continue;
-				};
-				if (opt == "lib-version") {
-					if (optValue.isEmpty()) {
-						printf("Error: lib-version is empty\n");
-						return 1;
-					};
-					libVersion = optValue;
-					continue;
-				};
-				if (opt == "force-make") {
-					forceMake = true;
-					continue;
-				};
-				if (opt == "no-lib") {
-					noLib = true;
-					continue;
-				};
-
-				if (opt == "platform-compiler-msvc") {
-					optPlatformCompilerMSVC = true;
-				};
-				if (opt == "platform-compiler-gcc") {
-					optPlatformCompilerGCC = true;
-				};
-				if (opt == "platform-64bit") {
-					optPlatform64bit = true;
-				};
-				if (opt == "platform-32bit") {
-					optPlatform32bit = true;
-				};
-				if (opt == "platform-os-linux") {
-					optPlatformOSLinux = true;
-				};
-				if (opt == "platform-os-windows") {
-					optPlatformOSWindows = true;
-				};
-				if (opt == "platform-os-emscripten") {
-					optPlatformOSEmscripten = true;
-				};
-
-				continue;
-			};
-		};
-
-		if (cmdLine.length() == 0) {
-			showUsage();
-			return 0;
-		};
-
-		if ((!makeLibrary) && (!makeDynamicLibrary) && (!makeExecutable)) {
-			printf("Error: no exe/dll/lib specified to compile\n");
-			return 1;
-		};
-
-		// ---
-
-		TDynamicArray<String> cSource;
-		TDynamicArray<String> hFiles;
-		TDynamicArray<String> cppSource;
-		TDynamicArray<String> hppFiles;
-		TDynamicArray<String> rcFiles;
-
-		size_t k;
-
-		for (k = 0; k < srcH.length(); ++k) {
-			if (!Shell::fileExists(sourcePath + "/" + srcH[k])) {
-				printf("Error: file not found %s\n", srcH[k].value());
-				return 1;
-			};
-			hFiles.push(sourcePath + "/" + srcH[k]);
-		};
-
-		for (k = 0; k < srcC.length(); ++k) {
-			if (!Shell::fileExists(sourcePath + "/" + srcC[k])) {
-				printf("Error: file not found %s\n", srcC[k].value());
-				return 1;
-			};
-			cSource.push(sourcePath + "/" + srcC[k]);
-		};
-
-		for (k = 0; k < srcHpp.length(); ++k) {
-			if (!Shell::fileExists(sourcePath + "/" + srcHpp[k])) {
-				printf("Error: file not found %s\n", srcHpp[k].value());
-				return 1;
-			};
-			hppFiles.push(sourcePath + "/" + srcHpp[k]);
-		};
-
-		for (k = 0; k < srcCpp.length(); ++k) {
-			if (!Shell::fileExists(sourcePath + "/" + srcCpp[k])) {
-				printf("Error: file not found %s\n", srcCpp[k].value());
-				return 1;
-			};
-			cppSource.push(sourcePath + "/" + srcCpp[k]);
-		};
-
-		for (k = 0; k < srcRc.length(); ++k) {
-			if (!Shell::fileExists(sourcePath + "/" + srcRc[k])) {
-				printf("Error: file not found %s\n", srcRc[k].value());
-				return 1;
-			};
-			rcFiles.push(sourcePath + "/" + srcRc[k]);
-		};
-
-		// ---
-
-		String defInternal = projectName.toUpperCaseASCII() + "_INTERNAL";
-		defInternal = defInternal.replace("-", "_");
-		defInternal = defInternal.replace(".", "_");
-		if (projectName.beginWith("lib")) {
-			defInternal = defInternal.substring(3);
-		};
-		cppDefine.push(defInternal);
-
-		// ---
-
-		defInternal = "";
-		if (makeLibrary) {
-			defInternal = projectName.toUpperCaseASCII() + "_LIB_INTERNAL";
-		};
-		if (makeDynamicLibrary) {
-			defInternal = projectName.toUpperCaseASCII() + "_DLL_INTERNAL";
-		};
-		if (makeExecutable) {
-			defInternal = projectName.toUpperCaseASCII() + "_EXE_INTERNAL";
-		};
-		if (defInternal.length() > 0) {
-			defInternal = defInternal.replace("-", "_");
-			defInternal = defInternal.replace(".", "_");
-			if (projectName.beginWith("lib")) {
-				defInternal = defInternal.substring(3);
-			};
-			cppDefine.push(defInternal);
-		};
-
-		// ---
-
-		if (optPlatformCompilerMSVC) {
-			optPlatformCompilerGCC = false;
-		};
-		if (optPlatform64bit) {
-			optPlatform32bit = false;
-		};
-		if (optPlatformOSWindows) {
-			optPlatformOSLinux = false;
-			optPlatformOSEmscripten = false;
-		};
-		if (optPlatformOSLinux) {
-			optPlatformOSWindows = false;
-		};
-		if (optPlatformOSEmscripten) {
-			optPlatformOSWindows = false;
-			optPlatformOSLinux = true;
-		};
-
-		TPointer<ICompiler> compiler;
-		if (optPlatformCompilerMSVC) {
-			compiler = TMemory<CompilerMSVC>::newMemory();
-		};
-		if (optPlatformCompilerGCC) {
-			compiler = TMemory<CompilerGCC>::newMemory();
-		};
-
-		if (optPlatform64bit) {
-			compiler->is64Bit = true;
-		} else {
-			compiler->is64Bit = false;
-		};
-
-		if (optPlatform32bit) {
-			compiler->is32Bit = true;
-		} else {
-			compiler->is32Bit = false;
-		};
-
-		if (optPlatformOSWindows) {
-			compiler->isOSWindows = true;
-		} else {
-			compiler->isOSWindows = false;
-		};
-
-		if (optPlatformOSLinux) {
-			compiler->isOSLinux = true;
-		} else {
-			compiler->isOSLinux = false;
-		};
-
-		if (optPlatformOSEmscripten) {
-			compiler->isOSEmscripten = true;
-		} else {
-			compiler->isOSEmscripten = false;
-		};
-
-		compiler->isStatic = false;
-		if (Shell::hasEnv("XYO_PLATFORM_COMPILE_STATIC")) {
-			String env = Shell::getEnv("XYO_PLATFORM_COMPILE_STATIC");
-			if (env == "1" || env == "ON" || env == "TRUE") {
-				cppDefine.push("XYO_PLATFORM_COMPILE_STATIC");
-				compiler->isStatic = true;
-			};
-		};
-
-		size_t strIndex;
-		if (platformName.indexOf("win64-msvc", 0, strIndex)) {
-			if (compiler->type != CompilerType::MSVC) {
-				compiler = TMemory<CompilerMSVC>::newMemory();
-			};
-			compiler->isOSWindows = true;
-			compiler->isOSLinux = false;
-			compiler->is64Bit = true;
-			compiler->is32Bit = false;
-		};
-		if (platformName.indexOf("win32-msvc", 0, strIndex)) {
-			if (compiler->type != CompilerType::MSVC) {
-				compiler = TMemory<CompilerMSVC>::newMemory();
-			};
-			compiler->isOSWindows = true;
-			compiler->isOSLinux = false;
-			compiler->is64Bit = false;
-			compiler->is32Bit = true;
-		};
-
-		// ---
-
-		if (makeLibrary) {
-			if ((cSource.isEmpty()) && (cppSource.isEmpty())) {
-				printf("Error: no c/cpp source for library %s\n", projectName.value());
-				return 1;
-			};
-			if (cSource.length() > 0) {
-				if (!compiler->makeCToLib(
-				        libName.length() ? libName : projectName,
-				        outputBinPath,
-				        outputLibPath,
-				        tempPath,
-				        (isRelease ? CompilerOptions::Release : CompilerOptions::Debug) | crtOption | CompilerOptions::StaticLibrary,
-				        cppDefine,
-				        incPath,
-				        hFiles,
-				        cSource,
-				        rcDefine,
-				        incPathRC,
-				        rcFiles,
-				        defFile,
-				        libDependencyPath,
-				        libDependency,
-				        libVersion,
-				        numThreads,
-				        true,
-				        forceMake)) {
-					printf("Error: building library %s\n", projectName.value());
-					return 1;
-				};
-			};
-			if (cppSource.length() > 0) {
-				if (!compiler->makeCppToLib(
-				        libName.length() ? libName : projectName,
-				        outputBinPath,
-				        outputLibPath,
-				        tempPath,
-				        (isRelease ? CompilerOptions::Release : CompilerOptions::Debug) | crtOption | CompilerOptions::StaticLibrary,
-				        cppDefine,
-				        incPath,
-				        hppFiles,
-				        cppSource,
-				        rcDefine,
-				        incPathRC,
-				        rcFiles,
-				        defFile,
-				        libDependencyPath,
-				        libDependency,
-				        libVersion,
-				        numThreads,
-				        true,
-				        forceMake)) {
-					printf("Error: building library %s\n", projectName.value());
-					return 1;
-				};
-			};
-		};
-
-		if (makeDynamicLibrary) {
-			if (noLib) {
-				outputLibPath = tempPath;
-			};
-
-			if ((cSource.isEmpty()) && (cppSource.isEmpty())) {
-				printf("Error: no c/cpp source for dynamic library %s\n", projectName.value());
-				return 1;
-			};
-			if (cSource.length() > 0) {
-				if (!compiler->makeCToLib(
-				        projectName,
-				        outputBinPath,
-				        outputLibPath,
-				        tempPath,
-				        (isRelease ? CompilerOptions::Release : CompilerOptions::Debug) | crtOption | CompilerOptions::DynamicLibrary | dllOption,
-				        cppDefine,
-				        incPath,
-				        hFiles,
-				        cSource,
-				        rcDefine,
-				        incPathRC,
-				        rcFiles,
-				        defFile,
-				        libDependencyPath,
-				        libDependency,
-				        libVersion,
-				        numThreads,
-				        true,
-				        forceMake)) {
-					printf("Error: building dynamic library %s\n", projectName.value());
-					return 1;
-				};
-			};
-
-			if (cppSource.length() > 0) {
-				if (!compiler->makeCppToLib(
-				        projectName,
-				        outputBinPath,
-				        outputLibPath,
-				        tempPath,
-				        (isRelease ? CompilerOptions::Release : CompilerOptions::Debug) | crtOption | CompilerOptions::DynamicLibrary | dllOption,
-				        cppDefine,
-				        incPath,
-				        hppFiles,
-				        cppSource,
-				        rcDefine,
-				        incPathRC,
-				        rcFiles,
-				        defFile,
-				        libDependencyPath,
-				        libDependency,
-				        libVersion,
-				        numThreads,
-				        true,
-				        forceMake)) {
-					printf("Error: building dynamic library %s\n", projectName.value());
-					return 1;
-				};
-			};
-		};
-
-		if (makeExecutable) {
-			if ((cSource.isEmpty()) && (cppSource.isEmpty())) {
-				printf("Error: no c/cpp source for executable %s\n", projectName.value());
-				return 1;
-			};
-			if (cSource.length() > 0) {
-				if (!compiler->makeCToExe(
-				        projectName,
-				        outputBinPath,
-				        tempPath,
-				        (isRelease ? CompilerOptions::Release : CompilerOptions::Debug) | crtOption | (compiler->isStatic ? CompilerOptions::StaticLibrary : CompilerOptions::DynamicLibrary),
-				        cppDefine,
-				        incPath,
-				        hFiles,
-				        cSource,
-				        rcDefine,
-				        incPathRC,
-				        rcFiles,
-				        libDependencyPath,
-				        libDependency,
-				        numThreads,
-				        true,
-				        forceMake)) {
-					printf("Error: building executable %s\n", projectName.value());
-					return 1;
-				};
-			};
-
-			if (cppSource.length() > 0) {
-				if (!compiler->makeCppToExe(
-				        projectName,
-				        outputBinPath,
-				        tempPath,
-				        (isRelease ? CompilerOptions::Release : CompilerOptions::Debug) | crtOption | (compiler->isStatic ? CompilerOptions::StaticLibrary : CompilerOptions::DynamicLibrary),
-				        cppDefine,
-				        incPath,
-				        hppFiles,
-				        cppSource,
-				        rcDefine,
-				        incPathRC,
-				        rcFiles,
-				        libDependencyPath,
-				        libDependency,
-				        numThreads,
-				        true,
-				        forceMake)) {
-					printf("Error: building executable %s\n", projectName.value());
-					return 1;
-				};
-			};
-		};
-		return 0;
-	};
-};
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_APPLICATION_LIBRARY
-XYO_APPLICATION_MAIN(XYO::CPPCompilerCommandDriver::Application::Application);
-#endif
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver.hpp>
+#include <XYO/CPPCompilerCommandDriver.Application/Application.hpp>
+#include <XYO/CPPCompilerCommandDriver.Application/Copyright.hpp>
+#include <XYO/CPPCompilerCommandDriver.Application/License.hpp>
+#include <XYO/CPPCompilerCommandDriver.Application/Version.hpp>
+#include <XYO/FileJSON.hpp>
+
+namespace XYO::CPPCompilerCommandDriver::Application {
+
+	void Application::showUsage() {
+		printf("C++ Compiler Command Driver\n");
+		showVersion();
+		printf("%s\n\n", CPPCompilerCommandDriver::Application::Copyright::copyright());
+
+		printf("%s",
+		       "options:\n"
+		       "    --help                    this info\n"
+		       "    --usage                   this info\n"
+		       "    --license                 show license\n"
+		       "    --version                 show version\n"
+		       "    --project=name            project name\n"
+		       "    --platform=name           platform name\n"
+		       "    --debug                   build debug version\n"
+		       "    --release                 build release version\n"
+		       "    --exe                     build executable (.exe)\n"
+		       "    --lib                     build library (.lib)\n"
+		       "    --dll                     build dynamic library (.dll)\n"
+		       "    --dll-x-static            build dynamic library with static linking (.dll)\n"
+		       "    --crt-dynamic             build using dynamic crt (default for dll)\n"
+		       "    --crt-static              build using static crt (default for lib)\n"
+		       "    --threads=count           specify number of threads to use, default by processors and memory limit\n"
+		       "    --def=value               add value to definitions\n"
+		       "    --inc=path                add path to include in search\n"
+		       "    --src-h=file              add file as h source\n"
+		       "    --src-c=file              add file as c source\n"
+		       "    --src-hpp=file            add file as hpp source\n"
+		       "    --src-cpp=file            add file as cpp source\n"
+		       "    --use-lib-path=path       add path to library search\n"
+		       "    --use-lib=library         add library to linker\n"
+		       "    --def-file=file           use file for linker definitions (.dll)\n"
+		       "    --rc-inc=path             add path to resource compiler include\n"
+		       "    --rc-def=value            add value to resource compiler definitions\n"
+		       "    --rc-src=file             add file as rc source\n"
+		       "    --source-path=path        folder where source files (.hpp/.h/.cpp/.c) are stored, default ./\n"
+		       "    --output-path=path        location to output folder, default ./\n"
+		       "    --temp-path=path          location to temp folder, default to ./temp\n"
+		       "    --output-bin-path=path    location to output bin folder, default to ./output\n"
+		       "    --output-lib-path=path    location to output lib folder, default to ./output\n"
+		       "    --lib-name=name           use name for static library\n"
+		       "    --lib-version=version     library name use version\n"
+		       "    --force-make              force build all\n"
+		       "    --no-lib                  do not generate library files (.lib), when build dll\n"
+		       "    --hwcaps=level            also build dll for glibc-hwcaps level (x86-64-v2/v3/v4)\n"
+		       "    --symbol-ordering=file    link functions in the order listed in file (from a profile run)\n"
+		       "    --linker=name             use linker (bfd, gold, lld, mold), default lld for symbol ordering\n"
+		       "    --hugepage-text           align executable text to 2 MiB for transparent huge pages\n"
+		       "    --split-debug             move debug info of dll/exe to .debug files and strip them\n"
+		       "    --pch=header              precompile header (as included, e.g. XYO/System.hpp) for cpp sources, not with --modules\n"
+		       "    --std=standard            c++ language standard (c++17, c++20, gnu++20, ...)\n"
+		       "    --modules                 build c++20 modules, module interfaces before importers\n"
+		       "    --header-unit=header      compile header (as included) as header unit, with --modules\n"
+		       "    --cache-path=path         reuse objects from compile cache in path\n"
+		       "    --cache-size=size         limit compile cache size (bytes, K, M, G), least recently used are evicted\n"
+		       "    --cache-stats             show compile cache statistics of --cache-path\n"
+		       "    --cache-bench             measure restore throughput of --cache-path by copy, link and clone\n"
+		       "    --remote-cache=url        share compile cache with http server at url\n"
+		       "    --reproducible[=root]     map paths under root (default current folder) to ., deterministic archives\n"
+		       "    --lto                     link time optimization, link jobs from the jobserver\n"
+		       "    --no-jobserver            do not join the make jobserver or serve one to child processes\n"
+		       "    --memory-budget=size      admit compile jobs by recorded peak memory (bytes, K, M, G or auto)\n"
+		       "    --fail-fast               on a compile error terminate running compiles, remove their objects\n"
+		       "    --keep-going              on a compile error compile all other sources, then list the errors\n"
+		       "    --background              run compilers at lowest cpu priority and idle io priority\n"
+		       "    --cpu-set=list            run compilers only on processors of list (0-3,6), threads default to their count\n"
+		       "    --job-timeout=seconds     terminate a compile running longer, retried once with fewer threads\n"
+		       "    --max-load=load           start no compile job while system load is above load, as make -l\n"
+		       "    --trace=file.json         record build jobs in chrome trace event format (ui.perfetto.dev)\n"
+		       "    --job-summary=file.json   record cpu time, peak memory and io of each job, top jobs by time and memory\n"
+		       "    --verbose                 show how threads and memory budget are chosen\n"
+		       "    --no-echo                 do not show commands as they run\n"
+		       "    --cache-server=port       serve --cache-path as remote cache on 127.0.0.1:port\n"
+		       "    --unity=n                 generate unity sources, n cpp sources per unit\n"
+		       "    --unity-mode=mode         batch sources by size or by shared includes (size, include)\n"
+		       "    --unity-stable=seconds    edited sources stay out of unity until unchanged for seconds (default 300, 0 off)\n"
+		       "    --platform-compiler-msvc  use msvc compiler\n"
+		       "    --platform-compiler-gcc   use gcc compiler\n"
+		       "    --platform-64bit          compile for 64bit\n"
+		       "    --platform-32bit          compile for 32bit\n"
+		       "    --platform-os-linux       platform os is linux\n"
+		       "    --platform-os-windows     platform os is windows\n"
+		       "    --platform-os-emscripten  platform os is emscripten\n");
+		printf("\n");
+	};
+
+	void Application::showLicense() {
+		printf("%s", CPPCompilerCommandDriver::Application::License::license().c_str());
+	};
+
+	void Application::showVersion() {
+		printf("version %s build %s [%s]\n", CPPCompilerCommandDriver::Application::Version::version(), CPPCompilerCommandDriver::Application::Version::build(), CPPCompilerCommandDriver::Application::Version::datetime());
+	};
+
+	void Application::initMemory() {
+		String::initMemory();
+		TDynamicArray<String>::initMemory();
+	};
+
+	int Application::main(int cmdN, char *cmdS[]) {
+		int i;
+		String opt;
+		size_t optIndex;
+		String optValue;
+		TDynamicArray<String> cmdLine;
+
+		// ---
+
+		String projectName = "project";
+		int crtOption = CompilerOptions::CRTDynamic;
+		int dllOption = CompilerOptions::None;
+
+		bool makeExecutable = false;
+		bool makeLibrary = false;
+		bool makeDynamicLibrary = false;
+		bool isRelease = true;
+
+		String threadsDecision;
+		int numThreads = Process::getProcessorCount(threadsDecision);
+		TDynamicArray<String> cppDefine;
+		TDynamicArray<String> incPath;
+		TDynamicArray<String> srcH;
+		TDynamicArray<String> srcC;
+		TDynamicArray<String> srcHpp;
+		TDynamicArray<String> srcCpp;
+		TDynamicArray<String> libDependencyPath;
+		TDynamicArray<String> libDependency;
+		String defFile;
+
+		TDynamicArray<String> rcDefine;
+		TDynamicArray<String> incPathRC;
+		TDynamicArray<String> srcRc;
+
+		String sourcePath = ".";
+		String outputPath = ".";
+		String tempPath = "./temp";
+		String outputBinPath = outputPath;
+		String outputLibPath = outputPath;
+		String libName;
+		String libVersion;
+		String platformName = XYO_PLATFORM_NAME;
+
+		bool optPlatformCompilerMSVC = false;
+		bool optPlatformCompilerGCC = false;
+		bool optPlatform64bit = false;
+		bool optPlatform32bit = false;
+		bool optPlatformOSLinux = false;
+		bool optPlatformOSWindows = false;
+		bool optPlatformOSEmscripten = false;
+
+		bool forceMake = false;
+		bool noLib = false;
+		TDynamicArray<String> hwcaps;
+		String symbolOrderingFile;
+		String linker;
+		bool hugePageText = false;
+		bool splitDebug = false;
+		String precompiledHeader;
+		String standard;
+		bool modules = false;
+		TDynamicArray<String> headerUnits;
+		String cachePath;
+		uint64_t cacheSize = 0;
+		bool cacheStats = false;
+		bool cacheBench = false;
+		String remoteCache;
+		int cacheServerPort = 0;
+		String reproducibleRoot;
+		bool lto = false;
+		bool useJobServer = true;
+		uint64_t memoryBudget = 0;
+		String memoryBudgetDecision;
+		double maxLoad = 0;
+		double jobTimeout = 0;
+		bool background = false;
+		String traceFile;
+		String jobSummaryFile;
+		String cpuSet;
+		bool failFast = false;
+		bool keepGoing = false;
+		bool verbose = false;
+		bool echoCmd = true;
+		int unityBatchSize = 0;
+		int unityStableTime = 300;
+		String unityMode = "size";
+
+		// ---
+
+#ifdef XYO_PLATFORM_COMPILER_MSVC
+		optPlatformCompilerMSVC = true;
+#endif
+#ifdef XYO_PLATFORM_COMPILER_GCC
+		optPlatformCompilerGCC = true;
+#endif
+
+#ifdef XYO_PLATFORM_64BIT
+		optPlatform64bit = true;
+#endif
+#ifdef XYO_PLATFORM_32BIT
+		optPlatform32bit = true;
+#endif
+
+#ifdef XYO_PLATFORM_OS_LINUX
+		optPlatformOSLinux = true;
+#endif
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		optPlatformOSWindows = true;
+#endif
+#ifdef XYO_PLATFORM_OS_EMSCRIPTEN
+		optPlatformOSEmscripten = true;
+#endif
+
+		if (Shell::hasEnv("XYO_PLATFORM_COMPILER_MSVC")) {
+			optPlatformCompilerMSVC = true;
+		};
+		if (Shell::hasEnv("XYO_PLATFORM_COMPILER_GCC")) {
+			optPlatformCompilerGCC = true;
+		};
+		if (Shell::hasEnv("XYO_PLATFORM_64BIT")) {
+			optPlatform64bit = true;
+		};
+		if (Shell::hasEnv("XYO_PLATFORM_32BIT")) {
+			optPlatform32bit = true;
+		};
+		if (Shell::hasEnv("XYO_PLATFORM_OS_LINUX")) {
+			optPlatformOSLinux = true;
+		};
+		if (Shell::hasEnv("XYO_PLATFORM_OS_WINDOWS")) {
+			optPlatformOSWindows = true;
+		};
+		if (Shell::hasEnv("XYO_PLATFORM_OS_EMSCRIPTEN")) {
+			optPlatformOSEmscripten = true;
+		};
+
+		// ---
+
+		if (Shell::hasEnv("XYO_PLATFORM_COMPILE_DEBUG")) {
+			String env = Shell::getEnv("XYO_PLATFORM_COMPILE_DEBUG");
+			if (env == "1" || env == "ON" || env == "TRUE") {
+				isRelease = false;
+			};
+		};
+
+		if (Shell::hasEnv("XYO_PLATFORM_COMPILE_CRT_STATIC")) {
+			String env = Shell::getEnv("XYO_PLATFORM_COMPILE_CRT_STATIC");
+			if (env == "1" || env == "ON" || env == "TRUE") {
+				crtOption = CompilerOptions::CRTStatic;
+			};
+		};
+
+		Shell::getEnv("XYO_PLATFORM_COMPILE_DEFINE").explode(" ", cppDefine);
+
+		// ---
+
+		for (i = 1; i < cmdN; ++i) {
+			if (StringCore::beginWith(cmdS[i], "@")) {
+				String content;
+				if (StringCore::endsWith(cmdS[i], ".json")) {
+					TPointer<FileJSON::Value> json;
+					if (!FileJSON::load(&cmdS[i][1], json)) {
+						printf("Error: json file load - %s\n", &cmdS[i][1]);
+						return 1;
+					};
+					FileJSON::VAssociativeArray *jsonInfo = TDynamicCast<FileJSON::VAssociativeArray *>(json);
+					if (!jsonInfo) {
+						printf("Error: json no info - %s\n", &cmdS[i][1]);
+						return 1;
+					};
+					int k, m, j;
+					String key;
+					FileJSON::Value *item;
+					FileJSON::VString *vString;
+					FileJSON::VArray *vArray;
+					FileJSON::VAssociativeArray *vAssociativeArray;
+					for (k = 0; k < jsonInfo->value->length(); ++k) {
+						key = jsonInfo->value->arrayKey->index(k);
+						item = jsonInfo->value->arrayValue->index(k);
+						if (key == "project") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--project=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - project - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "type") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - type - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "defines") {
+							vArray = TDynamicCast<FileJSON::VArray *>(item);
+							if (vArray) {
+								for (m = 0; m < vArray->value->length(); ++m) {
+									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+									if (vString) {
+										cmdLine.push(String("--def=") + vString->value);
+										continue;
+									};
+									printf("Error: json syntax - defines/items -  %s\n", &cmdS[i][1]);
+									return 1;
+								};
+								continue;
+							};
+							printf("Error: json syntax - defines - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "includePath") {
+							vArray = TDynamicCast<FileJSON::VArray *>(item);
+							if (vArray) {
+								for (m = 0; m < vArray->value->length(); ++m) {
+									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+									if (vString) {
+										cmdLine.push(String("--inc=") + vString->value);
+										continue;
+									};
+									printf("Error: json syntax - includePath/items - %s\n", &cmdS[i][1]);
+									return 1;
+								};
+								continue;
+							};
+							printf("Error: json syntax - includePath - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "hSource") {
+							vArray = TDynamicCast<FileJSON::VArray *>(item);
+							if (vArray) {
+								for (m = 0; m < vArray->value->length(); ++m) {
+									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+									if (vString) {
+										cmdLine.push(String("--src-h=") + vString->value);
+										continue;
+									};
+									printf("Error: json syntax - hSource/items - %s\n", &cmdS[i][1]);
+									return 1;
+								};
+								continue;
+							};
+							printf("Error: json syntax - hSource - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "cSource") {
+							vArray = TDynamicCast<FileJSON::VArray *>(item);
+							if (vArray) {
+								for (m = 0; m < vArray->value->length(); ++m) {
+									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+									if (vString) {
+										cmdLine.push(String("--src-c=") + vString->value);
+										continue;
+									};
+									printf("Error: json syntax - cSource/items - %s\n", &cmdS[i][1]);
+									return 1;
+								};
+								continue;
+							};
+							printf("Error: json syntax - cSource - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "hppSource") {
+							vArray = TDynamicCast<FileJSON::VArray *>(item);
+							if (vArray) {
+								for (m = 0; m < vArray->value->length(); ++m) {
+									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+									if (vString) {
+										cmdLine.push(String("--src-hpp=") + vString->value);
+										continue;
+									};
+									printf("Error: json syntax - hppSource/items - %s\n", &cmdS[i][1]);
+									return 1;
+								};
+								continue;
+							};
+							printf("Error: json syntax - hppSource - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "cppSource") {
+							vArray = TDynamicCast<FileJSON::VArray *>(item);
+							if (vArray) {
+								for (m = 0; m < vArray->value->length(); ++m) {
+									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+									if (vString) {
+										cmdLine.push(String("--src-cpp=") + vString->value);
+										continue;
+									};
+									printf("Error: json syntax - cppSource/items - %s\n", &cmdS[i][1]);
+									return 1;
+								};
+								continue;
+							};
+							printf("Error: json syntax - cppSource - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "resources") {
+							vAssociativeArray = TDynamicCast<FileJSON::VAssociativeArray *>(item);
+							if (vAssociativeArray) {
+								String vKey;
+								FileJSON::Value *vItem;
+								for (j = 0; j < vAssociativeArray->value->length(); ++j) {
+									vKey = vAssociativeArray->value->arrayKey->index(j);
+									vItem = vAssociativeArray->value->arrayValue->index(j);
+									if (vKey == "defines") {
+										vArray = TDynamicCast<FileJSON::VArray *>(vItem);
+										if (vArray) {
+											for (m = 0; m < vArray->value->length(); ++m) {
+												vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+												if (vString) {
+													cmdLine.push(String("--rc-def=") + vString->value);
+													continue;
+												};
+												printf("Error: json syntax - resources - defines/items - %s\n", &cmdS[i][1]);
+												return 1;
+											};
+											continue;
+										};
+										printf("Error: json syntax - resources - defines - %s\n", &cmdS[i][1]);
+										return 1;
+									};
+									if (vKey == "includePath") {
+										vArray = TDynamicCast<FileJSON::VArray *>(vItem);
+										if (vArray) {
+											for (m = 0; m < vArray->value->length(); ++m) {
+												vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+												if (vString) {
+													cmdLine.push(String("--rc-inc=") + vString->value);
+													continue;
+												};
+												printf("Error: json syntax - resources - includePath/items - %s\n", &cmdS[i][1]);
+												return 1;
+											};
+											continue;
+										};
+										printf("Error: json syntax - resources - includePath - %s\n", &cmdS[i][1]);
+										return 1;
+									};
+									if (vKey == "rcSource") {
+										vArray = TDynamicCast<FileJSON::VArray *>(vItem);
+										if (vArray) {
+											for (m = 0; m < vArray->value->length(); ++m) {
+												vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+												if (vString) {
+													cmdLine.push(String("--rc-src=") + vString->value);
+													continue;
+												};
+												printf("Error: json syntax - resources - rcSource/items - %s\n", &cmdS[i][1]);
+												return 1;
+											};
+											continue;
+										};
+										printf("Error: json syntax - resources - rcSource - %s\n", &cmdS[i][1]);
+										return 1;
+									};
+									printf("Error: json syntax - resources/items - %s\n", &cmdS[i][1]);
+									return 1;
+								};
+								continue;
+							};
+							printf("Error: json syntax - resources - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "crt") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--crt-") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - crt - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "libraryPath") {
+							vArray = TDynamicCast<FileJSON::VArray *>(item);
+							if (vArray) {
+								for (m = 0; m < vArray->value->length(); ++m) {
+									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+									if (vString) {
+										cmdLine.push(String("--use-lib-path=") + vString->value);
+										continue;
+									};
+									printf("Error: json syntax - libraryPath/items - %s\n", &cmdS[i][1]);
+									return 1;
+								};
+								continue;
+							};
+							printf("Error: json syntax - libraryPath - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "library") {
+							vArray = TDynamicCast<FileJSON::VArray *>(item);
+							if (vArray) {
+								for (m = 0; m < vArray->value->length(); ++m) {
+									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+									if (vString) {
+										cmdLine.push(String("--use-lib=") + vString->value);
+										continue;
+									};
+									printf("Error: json syntax - library/items - %s\n", &cmdS[i][1]);
+									return 1;
+								};
+								continue;
+							};
+							printf("Error: json syntax - library - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "linkerDefinitionsFile") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--def-file=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - linkerDefinitionsFile - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "symbolOrderingFile") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--symbol-ordering=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - symbolOrderingFile - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "linker") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--linker=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - linker - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "hugePageText") {
+							FileJSON::VBoolean *vBoolean = TDynamicCast<FileJSON::VBoolean *>(item);
+							if (vBoolean) {
+								if (vBoolean->value) {
+									cmdLine.push("--hugepage-text");
+								};
+								continue;
+							};
+							printf("Error: json syntax - hugePageText - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "splitDebug") {
+							FileJSON::VBoolean *vBoolean = TDynamicCast<FileJSON::VBoolean *>(item);
+							if (vBoolean) {
+								if (vBoolean->value) {
+									cmdLine.push("--split-debug");
+								};
+								continue;
+							};
+							printf("Error: json syntax - splitDebug - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "precompiledHeader") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--pch=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - precompiledHeader - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "standard") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--std=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - standard - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "modules") {
+							FileJSON::VBoolean *vBoolean = TDynamicCast<FileJSON::VBoolean *>(item);
+							if (vBoolean) {
+								if (vBoolean->value) {
+									cmdLine.push("--modules");
+								};
+								continue;
+							};
+							printf("Error: json syntax - modules - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "headerUnits") {
+							vArray = TDynamicCast<FileJSON::VArray *>(item);
+							if (vArray) {
+								for (m = 0; m < vArray->value->length(); ++m) {
+									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+									if (vString) {
+										cmdLine.push(String("--header-unit=") + vString->value);
+										continue;
+									};
+									printf("Error: json syntax - headerUnits/items - %s\n", &cmdS[i][1]);
+									return 1;
+								};
+								continue;
+							};
+							printf("Error: json syntax - headerUnits - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "cachePath") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--cache-path=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - cachePath - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "cacheSize") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--cache-size=") + vString->value);
+								continue;
+							};
+							FileJSON::VNumber *vNumber = TDynamicCast<FileJSON::VNumber *>(item);
+							if (vNumber) {
+								char buffer[64];
+								snprintf(buffer, sizeof(buffer), "--cache-size=%.0f", vNumber->value);
+								cmdLine.push(buffer);
+								continue;
+							};
+							printf("Error: json syntax - cacheSize - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "remoteCache") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--remote-cache=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - remoteCache - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "lto") {
+							FileJSON::VBoolean *vBoolean = TDynamicCast<FileJSON::VBoolean *>(item);
+							if (vBoolean) {
+								if (vBoolean->value) {
+									cmdLine.push("--lto");
+								};
+								continue;
+							};
+							printf("Error: json syntax - lto - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "jobServer") {
+							FileJSON::VBoolean *vBoolean = TDynamicCast<FileJSON::VBoolean *>(item);
+							if (vBoolean) {
+								if (!vBoolean->value) {
+									cmdLine.push("--no-jobserver");
+								};
+								continue;
+							};
+							printf("Error: json syntax - jobServer - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "memoryBudget") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--memory-budget=") + vString->value);
+								continue;
+							};
+							FileJSON::VNumber *vNumber = TDynamicCast<FileJSON::VNumber *>(item);
+							if (vNumber) {
+								char buffer[64];
+								snprintf(buffer, sizeof(buffer), "--memory-budget=%.0f", vNumber->value);
+								cmdLine.push(buffer);
+								continue;
+							};
+							printf("Error: json syntax - memoryBudget - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "failFast") {
+							FileJSON::VBoolean *vBoolean = TDynamicCast<FileJSON::VBoolean *>(item);
+							if (vBoolean) {
+								if (vBoolean->value) {
+									cmdLine.push("--fail-fast");
+								};
+								continue;
+							};
+							printf("Error: json syntax - failFast - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "keepGoing") {
+							FileJSON::VBoolean *vBoolean = TDynamicCast<FileJSON::VBoolean *>(item);
+							if (vBoolean) {
+								if (vBoolean->value) {
+									cmdLine.push("--keep-going");
+								};
+								continue;
+							};
+							printf("Error: json syntax - keepGoing - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "trace") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--trace=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - trace - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "jobSummary") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--job-summary=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - jobSummary - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "background") {
+							FileJSON::VBoolean *vBoolean = TDynamicCast<FileJSON::VBoolean *>(item);
+							if (vBoolean) {
+								if (vBoolean->value) {
+									cmdLine.push("--background");
+								};
+								continue;
+							};
+							printf("Error: json syntax - background - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "cpuSet") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--cpu-set=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - cpuSet - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "jobTimeout") {
+							FileJSON::VNumber *vNumber = TDynamicCast<FileJSON::VNumber *>(item);
+							if (vNumber) {
+								char buffer[64];
+								snprintf(buffer, sizeof(buffer), "--job-timeout=%g", vNumber->value);
+								cmdLine.push(buffer);
+								continue;
+							};
+							printf("Error: json syntax - jobTimeout - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "maxLoad") {
+							FileJSON::VNumber *vNumber = TDynamicCast<FileJSON::VNumber *>(item);
+							if (vNumber) {
+								char buffer[64];
+								snprintf(buffer, sizeof(buffer), "--max-load=%g", vNumber->value);
+								cmdLine.push(buffer);
+								continue;
+							};
+							printf("Error: json syntax - maxLoad - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "verbose") {
+							FileJSON::VBoolean *vBoolean = TDynamicCast<FileJSON::VBoolean *>(item);
+							if (vBoolean) {
+								if (vBoolean->value) {
+									cmdLine.push("--verbose");
+								};
+								continue;
+							};
+							printf("Error: json syntax - verbose - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "echo") {
+							FileJSON::VBoolean *vBoolean = TDynamicCast<FileJSON::VBoolean *>(item);
+							if (vBoolean) {
+								if (!vBoolean->value) {
+									cmdLine.push("--no-echo");
+								};
+								continue;
+							};
+							printf("Error: json syntax - echo - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "reproducible") {
+							FileJSON::VBoolean *vBoolean = TDynamicCast<FileJSON::VBoolean *>(item);
+							if (vBoolean) {
+								if (vBoolean->value) {
+									cmdLine.push("--reproducible");
+								};
+								continue;
+							};
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--reproducible=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - reproducible - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "unityBatchSize") {
+							FileJSON::VNumber *vNumber = TDynamicCast<FileJSON::VNumber *>(item);
+							if (vNumber) {
+								char buffer[32];
+								snprintf(buffer, sizeof(buffer), "--unity=%d", (int)vNumber->value);
+								cmdLine.push(buffer);
+								continue;
+							};
+							printf("Error: json syntax - unityBatchSize - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "unityMode") {
+							vString = TDynamicCast<FileJSON::VString *>(item);
+							if (vString) {
+								cmdLine.push(String("--unity-mode=") + vString->value);
+								continue;
+							};
+							printf("Error: json syntax - unityMode - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "unityStableTime") {
+							FileJSON::VNumber *vNumber = TDynamicCast<FileJSON::VNumber *>(item);
+							if (vNumber) {
+								char buffer[64];
+								snprintf(buffer, sizeof(buffer), "--unity-stable=%d", (int)vNumber->value);
+								cmdLine.push(buffer);
+								continue;
+							};
+							printf("Error: json syntax - unityStableTime - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+						if (key == "hwcaps") {
+							vArray = TDynamicCast<FileJSON::VArray *>(item);
+							if (vArray) {
+								for (m = 0; m < vArray->value->length(); ++m) {
+									vString = TDynamicCast<FileJSON::VString *>(vArray->value->index(m));
+									if (vString) {
+										cmdLine.push(String("--hwcaps=") + vString->value);
+										continue;
+									};
+									printf("Error: json syntax - hwcaps/items - %s\n", &cmdS[i][1]);
+									return 1;
+								};
+								continue;
+							};
+							printf("Error: json syntax - hwcaps - %s\n", &cmdS[i][1]);
+							return 1;
+						};
+					};
+				};
+				if (Shell::fileGetContents(&cmdS[i][1], content)) {
+					XYO::System::ShellArguments shellArguments;
+					int m;
+					shellArguments.set(content);
+					for (m = 0; m < shellArguments.cmdN; ++m) {
+						cmdLine.push(shellArguments.cmdS[m]);
+					};
+					continue;
+				};
+				printf("Error: file not found - %s\n", &cmdS[i][1]);
+				return 1;
+			};
+			cmdLine.push(cmdS[i]);
+		};
+
+		for (i = 0; i < cmdLine.length(); ++i) {
+			if (StringCore::beginWith(cmdLine[i], "--")) {
+				opt = cmdLine[i].index(2);
+				optValue = "";
+				if (opt.indexOf("=", 0, optIndex)) {
+					optValue = opt.substring(optIndex + 1);
+					opt = opt.substring(0, optIndex);
+				};
+				if (opt == "help") {
+					showUsage();
+					return 0;
+				};
+				if (opt == "usage") {
+					showUsage();
+					return 0;
+				};
+				if (opt == "license") {
+					showLicense();
+					return 0;
+				};
+				if (opt == "version") {
+					showVersion();
+					return 0;
+				};
+				if (opt == "project") {
+					if (optValue.length() == 0) {
+						printf("Error: project is empty\n");
+						return 1;
+					};
+					projectName = optValue;
+					continue;
+				};
+				if (opt == "platform") {
+					if (optValue.length() == 0) {
+						printf("Error: platform is empty\n");
+						return 1;
+					};
+					platformName = optValue;
+					continue;
+				};
+				if (opt == "debug") {
+					isRelease = false;
+					continue;
+				};
+				if (opt == "release") {
+					isRelease = true;
+					continue;
+				};
+				if (opt == "exe") {
+					makeExecutable = true;
+					continue;
+				};
+				if (opt == "lib") {
+					makeLibrary = true;
+					continue;
+				};
+				if (opt == "dll") {
+					makeDynamicLibrary = true;
+					continue;
+				};
+				if (opt == "dll-x-static") {
+					makeDynamicLibrary = true;
+					dllOption = CompilerOptions::DynamicLibraryXStatic;
+					continue;
+				};
+				if (opt == "crt-dynamic") {
+					crtOption = CompilerOptions::CRTDynamic;
+					continue;
+				};
+				if (opt == "crt-static") {
+					crtOption = CompilerOptions::CRTStatic;
+					continue;
+				};
+				if (opt == "threads") {
+					if (sscanf(optValue.value(), "%d", &numThreads) != 1) {
+						numThreads = Process::getProcessorCount(threadsDecision);
+						continue;
+					};
+					threadsDecision = "--threads";
+					continue;
+				};
+				if (opt == "def") {
+					if (optValue.isEmpty()) {
+						printf("Error: def parameter is empty\n");
+						return 1;
+					};
+					cppDefine.push(optValue);
+					continue;
+				};
+				if (opt == "inc") {
+					if (optValue.isEmpty()) {
+						printf("Error: inc path is empty\n");
+						return 1;
+					};
+					incPath.push(optValue);
+					continue;
+				};
+				if (opt == "src-h") {
+					if (optValue.isEmpty()) {
+						printf("Error: src-h file not provided\n");
+						return 1;
+					};
+					srcH.push(optValue);
+					continue;
+				};
+				if (opt == "src-c") {
+					if (optValue.isEmpty()) {
+						printf("Error: src-c file not provided\n");
+						return 1;
+					};
+					srcC.push(optValue);
+					continue;
+				};
+				if (opt == "src-hpp") {
+					if (optValue.isEmpty()) {
+						printf("Error: src-hpp file not provided\n");
+						return 1;
+					};
+					srcHpp.push(optValue);
+					continue;
+				};
+				if (opt == "src-cpp") {
+					if (optValue.isEmpty()) {
+						printf("Error: src-cpp file not provided\n");
+						return 1;
+					};
+					srcCpp.push(optValue);
+					continue;
+				};
+				if (opt == "use-lib-path") {
+					if (optValue.isEmpty()) {
+						printf("Error: use-lib-path is empty\n");
+						return 1;
+					};
+					libDependencyPath.push(optValue);
+					continue;
+				};
+				if (opt == "use-lib") {
+					if (optValue.isEmpty()) {
+						printf("Error: use-lib is empty\n");
+						return 1;
+					};
+					libDependency.push(optValue);
+					continue;
+				};
+				if (opt == "def-file") {
+					if (optValue.isEmpty()) {
+						printf("Error: def-file is empty\n");
+						return 1;
+					};
+					defFile = optValue;
+					continue;
+				};
+				if (opt == "rc-inc") {
+					if (optValue.isEmpty()) {
+						printf("Error: rc-inc path is empty\n");
+						return 1;
+					};
+					incPathRC.push(optValue);
+					continue;
+				};
+				if (opt == "rc-def") {
+					if (optValue.isEmpty()) {
+						printf("Error: rc-def parameter is empty\n");
+						return 1;
+					};
+					rcDefine.push(optValue);
+					continue;
+				};
+				if (opt == "rc-src") {
+					if (optValue.isEmpty()) {
+						printf("Error: rc-src file not provided\n");
+						return 1;
+					};
+					srcRc.push(optValue);
+					continue;
+				};
+				if (opt == "source-path") {
+					if (optValue.isEmpty()) {
+						printf("Error: source-path not provided\n");
+						return 1;
+					};
+					sourcePath = optValue;
+					continue;
+				};
+				if (opt == "output-path") {
+					if (optValue.isEmpty()) {
+						printf("Error: output-path not provided\n");
+						return 1;
+					};
+					outputPath = optValue;
+					outputBinPath = outputPath;
+					outputLibPath = outputPath;
+				};
+				if (opt == "temp-path") {
+					if (optValue.isEmpty()) {
+						printf("Error: temp-path is empty\n");
+						return 1;
+					};
+					tempPath = optValue;
+					continue;
+				};
+				if (opt == "output-bin-path") {
+					if (optValue.isEmpty()) {
+						printf("Error: output-bin-path is empty\n");
+						return 1;
+					};
+					outputBinPath = optValue;
+					continue;
+				};
+				if (opt == "output-lib-path") {
+					if (optValue.isEmpty()) {
+						printf("Error: output-lib-path is empty\n");
+						return 1;
+					};
+					outputLibPath = optValue;
+					continue;
+				};
+				if (opt == "lib-name") {
+					if (optValue.isEmpty()) {
+						printf("Error: lib-name is empty\n");
+						return 1;
+					};
+					libName = optValue;
+					continue;
+				};
+				if (opt == "lib-version") {
+					if (optValue.isEmpty()) {
+						printf("Error: lib-version is empty\n");
+						return 1;
+					};
+					libVersion = optValue;
+					continue;
+				};
+				if (opt == "force-make") {
+					forceMake = true;
+					continue;
+				};
+				if (opt == "no-lib") {
+					noLib = true;
+					continue;
+				};
+				if (opt == "symbol-ordering") {
+					if (optValue.isEmpty()) {
+						printf("Error: symbol-ordering file not provided\n");
+						return 1;
+					};
+					if (!Shell::fileExists(optValue)) {
+						printf("Error: file not found %s\n", optValue.value());
+						return 1;
+					};
+					symbolOrderingFile = optValue;
+					continue;
+				};
+				if (opt == "linker") {
+					if (optValue.isEmpty()) {
+						printf("Error: linker is empty\n");
+						return 1;
+					};
+					linker = optValue;
+					continue;
+				};
+				if (opt == "hugepage-text") {
+					hugePageText = true;
+					continue;
+				};
+				if (opt == "split-debug") {
+					splitDebug = true;
+					continue;
+				};
+				if (opt == "pch") {
+					if (optValue.isEmpty()) {
+						printf("Error: pch header not provided\n");
+						return 1;
+					};
+					precompiledHeader = optValue;
+					continue;
+				};
+				if (opt == "std") {
+					if (optValue.isEmpty()) {
+						printf("Error: std not provided\n");
+						return 1;
+					};
+					standard = optValue;
+					continue;
+				};
+				if (opt == "modules") {
+					modules = true;
+					continue;
+				};
+				if (opt == "header-unit") {
+					if (optValue.isEmpty()) {
+						printf("Error: header unit not provided\n");
+						return 1;
+					};
+					headerUnits.push(optValue);
+					continue;
+				};
+				if (opt == "cache-path") {
+					if (optValue.isEmpty()) {
+						printf("Error: cache path is empty\n");
+						return 1;
+					};
+					cachePath = optValue;
+					continue;
+				};
+				if (opt == "cache-size") {
+					if (!CompileCache::parseSize(optValue, cacheSize)) {
+						printf("Error: cache size not valid - %s\n", optValue.value());
+						return 1;
+					};
+					continue;
+				};
+				if (opt == "cache-stats") {
+					cacheStats = true;
+					continue;
+				};
+				if (opt == "cache-bench") {
+					cacheBench = true;
+					continue;
+				};
+				if (opt == "remote-cache") {
+					if (optValue.isEmpty()) {
+						printf("Error: remote cache url is empty\n");
+						return 1;
+					};
+					remoteCache = optValue;
+					continue;
+				};
+				if (opt == "lto") {
+					lto = true;
+					continue;
+				};
+				if (opt == "no-jobserver") {
+					useJobServer = false;
+					continue;
+				};
+				if (opt == "memory-budget") {
+					if (optValue == "auto") {
+						if (!Process::getAvailableMemory(memoryBudget)) {
+							printf("Error: available memory unknown, set memory budget size\n");
+							return 1;
+						};
+						memoryBudgetDecision = "available memory";
+						continue;
+					};
+					if (!CompileCache::parseSize(optValue, memoryBudget)) {
+						printf("Error: memory budget not valid - %s\n", optValue.value());
+						return 1;
+					};
+					memoryBudgetDecision = "--memory-budget";
+					continue;
+				};
+				if (opt == "fail-fast") {
+					failFast = true;
+					keepGoing = false;
+					continue;
+				};
+				if (opt == "keep-going") {
+					keepGoing = true;
+					failFast = false;
+					continue;
+				};
+				if (opt == "trace") {
+					if (optValue.isEmpty()) {
+						printf("Error: trace file is empty\n");
+						return 1;
+					};
+					traceFile = optValue;
+					continue;
+				};
+				if (opt == "job-summary") {
+					if (optValue.isEmpty()) {
+						printf("Error: job summary file is empty\n");
+						return 1;
+					};
+					jobSummaryFile = optValue;
+					continue;
+				};
+				if (opt == "background") {
+					background = true;
+					continue;
+				};
+				if (opt == "cpu-set") {
+					if (optValue.isEmpty()) {
+						printf("Error: cpu set is empty\n");
+						return 1;
+					};
+					cpuSet = optValue;
+					continue;
+				};
+				if (opt == "job-timeout") {
+					if ((sscanf(optValue.value(), "%lf", &jobTimeout) != 1) || (jobTimeout < 0)) {
+						printf("Error: job timeout not valid - %s\n", optValue.value());
+						return 1;
+					};
+					continue;
+				};
+				if (opt == "max-load") {
+					if (sscanf(optValue.value(), "%lf", &maxLoad) != 1) {
+						printf("Error: max load not valid - %s\n", optValue.value());
+						return 1;
+					};
+					continue;
+				};
+				if (opt == "verbose") {
+					verbose = true;
+					continue;
+				};
+				if (opt == "no-echo") {
+					echoCmd = false;
+					continue;
+				};
+				if (opt == "reproducible") {
+					reproducibleRoot = optValue;
+					if (reproducibleRoot.isEmpty()) {
+						reproducibleRoot = ".";
+					};
+					reproducibleRoot = FileSystem::absolutePath(reproducibleRoot).replace("\\", "/");
+					while ((reproducibleRoot.length() > 1) && reproducibleRoot.endsWith("/")) {
+						reproducibleRoot = reproducibleRoot.substring(0, reproducibleRoot.length() - 1);
+					};
+					if (reproducibleRoot.endsWith("/.")) {
+						reproducibleRoot = reproducibleRoot.substring(0, reproducibleRoot.length() - 2);
+					};
+					continue;
+				};
+				if (opt == "cache-server") {
+					if (sscanf(optValue.value(), "%d", &cacheServerPort) != 1 || cacheServerPort <= 0 || cacheServerPort > 65535) {
+						printf("Error: cache server port not valid - %s\n", optValue.value());
+						return 1;
+					};
+					continue;
+				};
+				if (opt == "unity") {
+					if (sscanf(optValue.value(), "%d", &unityBatchSize) != 1) {
+						printf("Error: unity batch size not valid - %s\n", optValue.value());
+						return 1;
+					};
+					continue;
+				};
+				if (opt == "unity-mode") {
+					if ((optValue != "size") && (optValue != "include")) {
+						printf("Error: unity mode not supported - %s\n", optValue.value());
+						return 1;
+					};
+					unityMode = optValue;
+					continue;
+				};
+				if (opt == "unity-stable") {
+					if (sscanf(optValue.value(), "%d", &unityStableTime) != 1) {
+						printf("Error: unity stable time not valid - %s\n", optValue.value());
+						return 1;
+					};
+					continue;
+				};
+				if (opt == "hwcaps") {
+					size_t m;
+					if (isaLevelOption(optValue) == CompilerOptions::None) {
+						printf("Error: hwcaps level not supported - %s\n", optValue.value());
+						return 1;
+					};
+					for (m = 0; m < hwcaps.length(); ++m) {
+						if (hwcaps[m] == optValue) {
+							break;
+						};
+					};
+					if (m == hwcaps.length()) {
+						hwcaps.push(optValue);
+					};
+					continue;
+				};
+
+				if (opt == "platform-compiler-msvc") {
+					optPlatformCompilerMSVC = true;
+				};
+				if (opt == "platform-compiler-gcc") {
+					optPlatformCompilerGCC = true;
+				};
+				if (opt == "platform-64bit") {
+					optPlatform64bit = true;
+				};
+				if (opt == "platform-32bit") {
+					optPlatform32bit = true;
+				};
+				if (opt == "platform-os-linux") {
+					optPlatformOSLinux = true;
+				};
+				if (opt == "platform-os-windows") {
+					optPlatformOSWindows = true;
+				};
+				if (opt == "platform-os-emscripten") {
+					optPlatformOSEmscripten = true;
+				};
+
+				continue;
+			};
+		};
+
+		if (cmdLine.length() == 0) {
+			showUsage();
+			return 0;
+		};
+
+		if (cacheStats) {
+			if (cachePath.isEmpty()) {
+				printf("Error: cache path not provided\n");
+				return 1;
+			};
+			CompileCache::showStatistics(cachePath);
+			return 0;
+		};
+
+		if (cacheBench) {
+			if (cachePath.isEmpty()) {
+				printf("Error: cache path not provided\n");
+				return 1;
+			};
+			if (!CompileCache::benchmarkRestore(cachePath, tempPath)) {
+				return 1;
+			};
+			return 0;
+		};
+
+		if (cacheServerPort) {
+			if (cachePath.isEmpty()) {
+				printf("Error: cache path not provided\n");
+				return 1;
+			};
+			if (!CacheServer::serve(cachePath, cacheServerPort)) {
+				return 1;
+			};
+			return 0;
+		};
+
+		if (!remoteCache.isEmpty()) {
+			if (cachePath.isEmpty()) {
+				cachePath = tempPath + "/xyo-cc.cache";
+			};
+		};
+
+		if ((!makeLibrary) && (!makeDynamicLibrary) && (!makeExecutable)) {
+			printf("Error: no exe/dll/lib specified to compile\n");
+			return 1;
+		};
+
+		// ---
+
+		TDynamicArray<String> cSource;
+		TDynamicArray<String> hFiles;
+		TDynamicArray<String> cppSource;
+		TDynamicArray<String> hppFiles;
+		TDynamicArray<String> rcFiles;
+
+		size_t k;
+
+		for (k = 0; k < srcH.length(); ++k) {
+			if (!Shell::fileExists(sourcePath + "/" + srcH[k])) {
+				printf("Error: file not found %s\n", srcH[k].value());
+				return 1;
+			};
+			hFiles.push(sourcePath + "/" + srcH[k]);
+		};
+
+		for (k = 0; k < srcC.length(); ++k) {
+			if (!Shell::fileExists(sourcePath + "/" + srcC[k])) {
+				printf("Error: file not found %s\n", srcC[k].value());
+				return 1;
+			};
+			cSource.push(sourcePath + "/" + srcC[k]);
+		};
+
+		for (k = 0; k < srcHpp.length(); ++k) {
+			if (!Shell::fileExists(sourcePath + "/" + srcHpp[k])) {
+				printf("Error: file not found %s\n", srcHpp[k].value());
+				return 1;
+			};
+			hppFiles.push(sourcePath + "/" + srcHpp[k]);
+		};
+
+		for (k = 0; k < srcCpp.length(); ++k) {
+			if (!Shell::fileExists(sourcePath + "/" + srcCpp[k])) {
+				printf("Error: file not found %s\n", srcCpp[k].value());
+				return 1;
+			};
+			cppSource.push(sourcePath + "/" + srcCpp[k]);
+		};
+
+		for (k = 0; k < srcRc.length(); ++k) {
+			if (!Shell::fileExists(sourcePath + "/" + srcRc[k])) {
+				printf("Error: file not found %s\n", srcRc[k].value());
+				return 1;
+			};
+			rcFiles.push(sourcePath + "/" + srcRc[k]);
+		};
+
+		// ---
+
+		String defInternal = projectName.toUpperCaseASCII() + "_INTERNAL";
+		defInternal = defInternal.replace("-", "_");
+		defInternal = defInternal.replace(".", "_");
+		if (projectName.beginWith("lib")) {
+			defInternal = defInternal.substring(3);
+		};
+		cppDefine.push(defInternal);
+
+		// ---
+
+		defInternal = "";
+		if (makeLibrary) {
+			defInternal = projectName.toUpperCaseASCII() + "_LIB_INTERNAL";
+		};
+		if (makeDynamicLibrary) {
+			defInternal = projectName.toUpperCaseASCII() + "_DLL_INTERNAL";
+		};
+		if (makeExecutable) {
+			defInternal = projectName.toUpperCaseASCII() + "_EXE_INTERNAL";
+		};
+		if (defInternal.length() > 0) {
+			defInternal = defInternal.replace("-", "_");
+			defInternal = defInternal.replace(".", "_");
+			if (projectName.beginWith("lib")) {
+				defInternal = defInternal.substring(3);
+			};
+			cppDefine.push(defInternal);
+		};
+
+		// ---
+
+		if (optPlatformCompilerMSVC) {
+			optPlatformCompilerGCC = false;
+		};
+		if (optPlatform64bit) {
+			optPlatform32bit = false;
+		};
+		if (optPlatformOSWindows) {
+			optPlatformOSLinux = false;
+			optPlatformOSEmscripten = false;
+		};
+		if (optPlatformOSLinux) {
+			optPlatformOSWindows = false;
+		};
+		if (optPlatformOSEmscripten) {
+			optPlatformOSWindows = false;
+			optPlatformOSLinux = true;
+		};
+
+		TPointer<ICompiler> compiler;
+		if (optPlatformCompilerMSVC) {
+			compiler = TMemory<CompilerMSVC>::newMemory();
+		};
+		if (optPlatformCompilerGCC) {
+			compiler = TMemory<CompilerGCC>::newMemory();
+		};
+
+		if (optPlatform64bit) {
+			compiler->is64Bit = true;
+		} else {
+			compiler->is64Bit = false;
+		};
+
+		if (optPlatform32bit) {
+			compiler->is32Bit = true;
+		} else {
+			compiler->is32Bit = false;
+		};
+
+		if (optPlatformOSWindows) {
+			compiler->isOSWindows = true;
+		} else {
+			compiler->isOSWindows = false;
+		};
+
+		if (optPlatformOSLinux) {
+			compiler->isOSLinux = true;
+		} else {
+			compiler->isOSLinux = false;
+		};
+
+		if (optPlatformOSEmscripten) {
+			compiler->isOSEmscripten = true;
+		} else {
+			compiler->isOSEmscripten = false;
+		};
+
+		compiler->isStatic = false;
+		if (Shell::hasEnv("XYO_PLATFORM_COMPILE_STATIC")) {
+			String env = Shell::getEnv("XYO_PLATFORM_COMPILE_STATIC");
+			if (env == "1" || env == "ON" || env == "TRUE") {
+				cppDefine.push("XYO_PLATFORM_COMPILE_STATIC");
+				compiler->isStatic = true;
+			};
+		};
+
+		size_t strIndex;
+		if (platformName.indexOf("win64-msvc", 0, strIndex)) {
+			if (compiler->type != CompilerType::MSVC) {
+				compiler = TMemory<CompilerMSVC>::newMemory();
+			};
+			compiler->isOSWindows = true;
+			compiler->isOSLinux = false;
+			compiler->is64Bit = true;
+			compiler->is32Bit = false;
+		};
+		if (platformName.indexOf("win32-msvc", 0, strIndex)) {
+			if (compiler->type != CompilerType::MSVC) {
+				compiler = TMemory<CompilerMSVC>::newMemory();
+			};
+			compiler->isOSWindows = true;
+			compiler->isOSLinux = false;
+			compiler->is64Bit = false;
+			compiler->is32Bit = true;
+		};
+
+		for (k = 0; k < hwcaps.length(); ++k) {
+			compiler->hwcaps.push(hwcaps[k]);
+		};
+		// bfd has no symbol ordering, gold orders sections, not symbols
+		if ((!symbolOrderingFile.isEmpty()) && (compiler->type != CompilerType::MSVC)) {
+			if ((linker == "bfd") || (linker == "gold")) {
+				printf("Error: symbol-ordering not supported by linker %s, use lld or mold\n", linker.value());
+				return 1;
+			};
+		};
+		compiler->symbolOrderingFile = symbolOrderingFile;
+		compiler->linker = linker;
+		compiler->hugePageText = hugePageText;
+		compiler->splitDebug = splitDebug;
+		compiler->precompiledHeader = precompiledHeader;
+		compiler->standard = standard;
+		compiler->cachePath = cachePath;
+		compiler->cacheSize = cacheSize;
+		compiler->remoteCache = remoteCache;
+		compiler->reproducibleRoot = reproducibleRoot;
+		compiler->lto = lto;
+		compiler->failFast = failFast;
+		compiler->keepGoing = keepGoing;
+		if (!traceFile.isEmpty()) {
+			BuildTrace::start(traceFile);
+		};
+		if (!jobSummaryFile.isEmpty()) {
+			BuildTrace::startSummary(jobSummaryFile);
+		};
+		// Before any thread starts, threads and commands inherit them
+		if (background) {
+			if (!Process::setBackground()) {
+				printf("Warning: background priority not set\n");
+			};
+		};
+		if (!cpuSet.isEmpty()) {
+			if (!Process::setProcessorSet(cpuSet)) {
+				printf("Error: cpu set not valid, processors 0 to %d - %s\n", Process::getProcessorLimit() - 1, cpuSet.value());
+				return 1;
+			};
+			if (threadsDecision != "--threads") {
+				numThreads = Process::getProcessorCount(threadsDecision);
+			};
+		};
+		// Each job needs its peak memory within the cgroup memory limit,
+		// the largest one of the history or an estimate without it
+		if (threadsDecision != "--threads") {
+			uint64_t limitedMemory;
+			if (Process::getLimitedMemory(limitedMemory)) {
+				uint64_t jobMemory = BuildHistory::largestPeakMemory(BuildHistory::fileName(tempPath, projectName));
+				const char *jobMemoryBy = "history peak";
+				int count;
+				char buffer[128];
+				if (jobMemory == 0) {
+					jobMemory = 512 * 1024 * 1024;
+					jobMemoryBy = "estimate";
+				};
+				count = (int)(limitedMemory / jobMemory);
+				if (count < 1) {
+					count = 1;
+				};
+				snprintf(buffer, sizeof(buffer), ", memory limit %.0f MiB for %d jobs of %.0f MiB %s",
+				         (double)limitedMemory / (1024.0 * 1024.0), count, (double)jobMemory / (1024.0 * 1024.0), jobMemoryBy);
+				threadsDecision << buffer;
+				if (count < numThreads) {
+					numThreads = count;
+				};
+			};
+		};
+		if (useJobServer) {
+			JobServer::start(numThreads);
+		};
+		MemoryBudget::setBudget(memoryBudget);
+		Process::setTimeout((uint64_t)(jobTimeout * 1000.0));
+		if (!LoadLimit::setMaximum(maxLoad)) {
+			printf("Warning: system load unknown, --max-load ignored\n");
+		};
+		if (verbose) {
+			printf("[threads] %d, by %s\n", numThreads, threadsDecision.value());
+			if (background) {
+				printf("[background] nice 19, idle io priority\n");
+			};
+			if (memoryBudget > 0) {
+				printf("[memory] budget %.0f MiB, by %s\n", (double)memoryBudget / (1024.0 * 1024.0), memoryBudgetDecision.value());
+			} else {
+				printf("[memory] no budget\n");
+			};
+			if (maxLoad > 0) {
+				double load;
+				if (LoadLimit::getLoad(load)) {
+					printf("[load] maximum %g, now %g\n", maxLoad, load);
+				};
+			};
+		};
+		compiler->modules = modules;
+		for (k = 0; k < headerUnits.length(); ++k) {
+			compiler->headerUnits.push(headerUnits[k]);
+		};
+		if (modules) {
+			if (standard.isEmpty()) {
+				compiler->standard = "c++20";
+			} else {
+				size_t index;
+				if (standard.indexOf("++", 0, index)) {
+					char version = standard[index + 2];
+					if ((version == '0') || (version == '1') || (version == '9')) {
+						printf("Error: modules require c++20 or newer - %s\n", standard.value());
+						return 1;
+					};
+				};
+			};
+			if (!precompiledHeader.isEmpty()) {
+				printf("Error: precompiled header not supported with modules, use --header-unit=%s\n", precompiledHeader.value());
+				return 1;
+			};
+		};
+
+		if (unityBatchSize > 1) {
+			UnityBuild unityBuild;
+			TDynamicArray<String> unitySource;
+			unityBuild.projectName = projectName;
+			unityBuild.tmpPath = tempPath;
+			unityBuild.batchSize = unityBatchSize;
+			unityBuild.stableTime = unityStableTime;
+			unityBuild.mode = unityMode;
+			for (k = 0; k < incPath.length(); ++k) {
+				unityBuild.incPath.push(incPath[k]);
+			};
+			unityBuild.echoCmd = echoCmd;
+			if (!unityBuild.generate(cppSource, unitySource)) {
+				printf("Error: unity sources for %s\n", projectName.value());
+				return 1;
+			};
+			cppSource.empty();
+			for (k = 0; k < unitySource.length(); ++k) {
+				cppSource.push(unitySource[k]);
+			};
+		};
+
+		// ---
+
+		if (makeLibrary) {
+			if ((cSource.isEmpty()) && (cppSource.isEmpty())) {
+				printf("Error: no c/cpp source for library %s\n", projectName.value());
+				return 1;
+			};
+			if (cSource.length() > 0) {
+				if (!compiler->makeCToLib(
+				        libName.length() ? libName : projectName,
+				        outputBinPath,
+				        outputLibPath,
+				        tempPath,
+				        (isRelease ? CompilerOptions::Release : CompilerOptions::Debug) | crtOption | CompilerOptions::StaticLibrary,
+				        cppDefine,
+				        incPath,
+				        hFiles,
+				        cSource,
+				        rcDefine,
+				        incPathRC,
+				        rcFiles,
+				        defFile,
+				        libDependencyPath,
+				        libDependency,
+				        libVersion,
+				        numThreads,
+				        echoCmd,
+				        forceMake)) {
+					printf("Error: building library %s\n", projectName.value());
+					return 1;
+				};
+			};
+			if (cppSource.length() > 0) {
+				if (!compiler->makeCppToLib(
+				        libName.length() ? libName : projectName,
+				        outputBinPath,
+				        outputLibPath,
+				        tempPath,
+				        (isRelease ? CompilerOptions::Release : CompilerOptions::Debug) | crtOption | CompilerOptions::StaticLibrary,
+				        cppDefine,
+				        incPath,
+				        hppFiles,
+				        cppSource,
+				        rcDefine,
+				        incPathRC,
+				        rcFiles,
+				        defFile,
+				        libDependencyPath,
+				        libDependency,
+				        libVersion,
+				        numThreads,
+				        echoCmd,
+				        forceMake)) {
+					printf("Error: building library %s\n", projectName.value());
+					return 1;
+				};
+			};
+		};
+
+		if (makeDynamicLibrary) {
+			if (noLib) {
+				outputLibPath = tempPath;
+			};
+
+			if ((cSource.isEmpty()) && (cppSource.isEmpty())) {
+				printf("Error: no c/cpp source for dynamic library %s\n", projectName.value());
+				return 1;
+			};
+			if (cSource.length() > 0) {
+				if (!compiler->makeCToLib(
+				        projectName,
+				        outputBinPath,
+				        outputLibPath,
+				        tempPath,
+				        (isRelease ? CompilerOptions::Release : CompilerOptions::Debug) | crtOption | CompilerOptions::DynamicLibrary | dllOption,
+				        cppDefine,
+				        incPath,
+				        hFiles,
+				        cSource,
+				        rcDefine,
+				        incPathRC,
+				        rcFiles,
+				        defFile,
+				        libDependencyPath,
+				        libDependency,
+				        libVersion,
+				        numThreads,
+				        echoCmd,
+				        forceMake)) {
+					printf("Error: building dynamic library %s\n", projectName.value());
+					return 1;
+				};
+			};
+
+			if (cppSource.length() > 0) {
+				if (!compiler->makeCppToLib(
+				        projectName,
+				        outputBinPath,
+				        outputLibPath,
+				        tempPath,
+				        (isRelease ? CompilerOptions::Release : CompilerOptions::Debug) | crtOption | CompilerOptions::DynamicLibrary | dllOption,
+				        cppDefine,
+				        incPath,
+				        hppFiles,
+				        cppSource,
+				        rcDefine,
+				        incPathRC,
+				        rcFiles,
+				        defFile,
+				        libDependencyPath,
+				        libDependency,
+				        libVersion,
+				        numThreads,
+				        echoCmd,
+				        forceMake)) {
+					printf("Error: building dynamic library %s\n", projectName.value());
+					return 1;
+				};
+			};
+		};
+
+		if (makeExecutable) {
+			if ((cSource.isEmpty()) && (cppSource.isEmpty())) {
+				printf("Error: no c/cpp source for executable %s\n", projectName.value());
+				return 1;
+			};
+			if (cSource.length() > 0) {
+				if (!compiler->makeCToExe(
+				        projectName,
+				        outputBinPath,
+				        tempPath,
+				        (isRelease ? CompilerOptions::Release : CompilerOptions::Debug) | crtOption | (compiler->isStatic ? CompilerOptions::StaticLibrary : CompilerOptions::DynamicLibrary),
+				        cppDefine,
+				        incPath,
+				        hFiles,
+				        cSource,
+				        rcDefine,
+				        incPathRC,
+				        rcFiles,
+				        libDependencyPath,
+				        libDependency,
+				        numThreads,
+				        echoCmd,
+				        forceMake)) {
+					printf("Error: building executable %s\n", projectName.value());
+					return 1;
+				};
+			};
+
+			if (cppSource.length() > 0) {
+				if (!compiler->makeCppToExe(
+				        projectName,
+				        outputBinPath,
+				        tempPath,
+				        (isRelease ? CompilerOptions::Release : CompilerOptions::Debug) | crtOption | (compiler->isStatic ? CompilerOptions::StaticLibrary : CompilerOptions::DynamicLibrary),
+				        cppDefine,
+				        incPath,
+				        hppFiles,
+				        cppSource,
+				        rcDefine,
+				        incPathRC,
+				        rcFiles,
+				        libDependencyPath,
+				        libDependency,
+				        numThreads,
+				        echoCmd,
+				        forceMake)) {
+					printf("Error: building executable %s\n", projectName.value());
+					return 1;
+				};
+			};
+		};
+
+		if (!cachePath.isEmpty()) {
+			printf("[cache] %s\n", (CompileCache::statistics()).value());
+			CompileCache::saveStatistics(cachePath);
+		};
+		if (!remoteCache.isEmpty()) {
+			printf("[remote-cache] %s\n", (RemoteCache::statistics()).value());
+		};
+		return 0;
+	};
+};
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_APPLICATION_LIBRARY
+XYO_APPLICATION_MAIN(XYO::CPPCompilerCommandDriver::Application::Application);
+#endif
@@ -1,19 +1,19 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#include <XYO/CPPCompilerCommandDriver.Application/License.hpp>
-
-namespace XYO::CPPCompilerCommandDriver::Application::License {
-
-	std::string license() {
-		return XYO::CPPCompilerCommandDriver::License::license();
-	};
-
-	std::string shortLicense() {
-		return XYO::CPPCompilerCommandDriver::License::shortLicense();
-	};
-
-};
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver.Application/License.hpp>
+
+namespace XYO::CPPCompilerCommandDriver::Application::License {
+
+	std::string license() {
+		return XYO::CPPCompilerCommandDriver::License::license();
+	};
+
+	std::string shortLicense() {
+		return XYO::CPPCompilerCommandDriver::License::shortLicense();
+	};
+
+};
@@ -1,13 +1,13 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_HPP
-#define XYO_CPPCOMPILERCOMMANDDRIVER_HPP
-
-#include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
-#include <XYO/CPPCompilerCommandDriver/Library.hpp>
-
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_HPP
+
+#include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#include <XYO/CPPCompilerCommandDriver/Library.hpp>
+
 #endif
\ No newline at end of file
@@ -0,0 +1,250 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/BuildHistory.hpp>
+#include <XYO/CPPCompilerCommandDriver/FileSystem.hpp>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace XYO::CPPCompilerCommandDriver::BuildHistory {
+
+	namespace BuildHistoryX {
+
+		struct Entry {
+				uint64_t duration;
+				uint64_t peakMemory;
+		};
+
+		static bool loadHistory(const String &historyFile, TAssociativeArray<String, Entry> &history) {
+			String content;
+			TDynamicArray<String> lines;
+			Entry entry;
+			size_t k;
+			size_t index;
+			size_t indexPeak;
+			size_t indexKey;
+
+			if (!Shell::fileGetContents(historyFile, content)) {
+				return false;
+			};
+			content.replace("\r", "").explode("\n", lines);
+			for (k = 0; k < lines.length(); ++k) {
+				if (!lines[k].indexOf("\t", 0, index)) {
+					continue;
+				};
+				if (!lines[k].indexOf("\t", index + 1, indexPeak)) {
+					continue;
+				};
+				entry.duration = strtoull(lines[k].substring(0, index).value(), nullptr, 10);
+				entry.peakMemory = 0;
+				// Lines without the memory column have a two field key
+				if (lines[k].indexOf("\t", indexPeak + 1, indexKey)) {
+					entry.peakMemory = strtoull(lines[k].substring(index + 1, indexPeak - index - 1).value(), nullptr, 10) * 1024;
+					index = indexPeak;
+				};
+				history.set(lines[k].substring(index + 1), entry);
+			};
+			return true;
+		};
+
+	};
+
+	using namespace BuildHistoryX;
+
+	String fileName(const String &tmpPath, const String &projectName) {
+		return tmpPath + "/" + Shell::getFileName(projectName) + ".history.txt";
+	};
+
+	String jobKey(int options, const String &srcFile) {
+		char buffer[32];
+		snprintf(buffer, sizeof(buffer), "%08x\t", options);
+		return String(buffer) + srcFile.replace("\\", "/");
+	};
+
+	void expectedDurations(const String &historyFile, TDynamicArray<String> &keys, TDynamicArray<String> &srcFiles, TDynamicArray<uint64_t> &durations, size_t &known) {
+		TAssociativeArray<String, Entry> history;
+		TDynamicArray<uint64_t> size;
+		TDynamicArray<bool> isKnown;
+		Entry entry;
+		uint64_t knownDuration = 0;
+		uint64_t knownSize = 0;
+		size_t k;
+
+		loadHistory(historyFile, history);
+		known = 0;
+		for (k = 0; k < keys.length(); ++k) {
+			if (!FileSystem::getFileSize(srcFiles[k], size[k])) {
+				size[k] = 0;
+			};
+			durations[k] = 0;
+			isKnown[k] = false;
+			if (history.get(keys[k], entry)) {
+				durations[k] = entry.duration;
+				isKnown[k] = true;
+				knownDuration += entry.duration;
+				knownSize += size[k];
+				++known;
+			};
+		};
+
+		// Without history any scale gives the same order, 1 ms per KiB
+		for (k = 0; k < keys.length(); ++k) {
+			if (isKnown[k]) {
+				continue;
+			};
+			if ((knownSize > 0) && (knownDuration > 0)) {
+				durations[k] = (uint64_t)((double)size[k] * (double)knownDuration / (double)knownSize);
+				continue;
+			};
+			durations[k] = size[k] / 1024;
+		};
+	};
+
+	void longestFirst(TDynamicArray<uint64_t> &durations, TDynamicArray<size_t> &order) {
+		TDynamicArray<size_t> merged;
+		size_t length = durations.length();
+		size_t width;
+		size_t left;
+		size_t middle;
+		size_t right;
+		size_t a;
+		size_t b;
+		size_t k;
+
+		order.empty();
+		for (k = 0; k < length; ++k) {
+			order.push(k);
+			merged.push(k);
+		};
+		// Bottom-up merge sort, a right run goes first only if longer
+		for (width = 1; width < length; width *= 2) {
+			for (left = 0; left < length; left += 2 * width) {
+				middle = (left + width < length) ? (left + width) : length;
+				right = (middle + width < length) ? (middle + width) : length;
+				a = left;
+				b = middle;
+				for (k = left; k < right; ++k) {
+					if ((a < middle) && ((b >= right) || (durations[order[a]] >= durations[order[b]]))) {
+						merged[k] = order[a++];
+						continue;
+					};
+					merged[k] = order[b++];
+				};
+			};
+			for (k = 0; k < length; ++k) {
+				order[k] = merged[k];
+			};
+		};
+	};
+
+	uint64_t makespan(TDynamicArray<uint64_t> &durations, TDynamicArray<size_t> &order, int threads) {
+		TDynamicArray<uint64_t> worker;
+		uint64_t retV = 0;
+		size_t first;
+		size_t k;
+		size_t m;
+
+		if (threads < 1) {
+			threads = 1;
+		};
+		for (m = 0; m < (size_t)threads; ++m) {
+			worker[m] = 0;
+		};
+		// Each job starts on the first worker to become free
+		for (k = 0; k < order.length(); ++k) {
+			first = 0;
+			for (m = 1; m < worker.length(); ++m) {
+				if (worker[m] < worker[first]) {
+					first = m;
+				};
+			};
+			worker[first] += durations[order[k]];
+			if (worker[first] > retV) {
+				retV = worker[first];
+			};
+		};
+		return retV;
+	};
+
+	void expectedPeakMemory(const String &historyFile, TDynamicArray<String> &keys, TDynamicArray<uint64_t> &peakMemory, size_t &known) {
+		TAssociativeArray<String, Entry> history;
+		Entry entry;
+		size_t k;
+
+		loadHistory(historyFile, history);
+		known = 0;
+		for (k = 0; k < keys.length(); ++k) {
+			peakMemory[k] = 0;
+			if (history.get(keys[k], entry)) {
+				if (entry.peakMemory > 0) {
+					peakMemory[k] = entry.peakMemory;
+					++known;
+				};
+			};
+		};
+	};
+
+	uint64_t largestPeakMemory(const String &historyFile) {
+		TAssociativeArray<String, Entry> history;
+		uint64_t retV = 0;
+		size_t k;
+
+		loadHistory(historyFile, history);
+		for (k = 0; k < history.length(); ++k) {
+			if (history.arrayValue->index(k).peakMemory > retV) {
+				retV = history.arrayValue->index(k).peakMemory;
+			};
+		};
+		return retV;
+	};
+
+	bool record(const String &historyFile, TDynamicArray<String> &keys, TDynamicArray<uint64_t> &durations, TDynamicArray<uint64_t> &peakMemory) {
+		TAssociativeArray<String, Entry> history;
+		Entry entry;
+		String content;
+		String tmpFile;
+		char buffer[64];
+		size_t k;
+
+		loadHistory(historyFile, history);
+		for (k = 0; k < keys.length(); ++k) {
+			if (!history.get(keys[k], entry)) {
+				entry.duration = durations[k];
+				entry.peakMemory = peakMemory[k];
+				history.set(keys[k], entry);
+				continue;
+			};
+			// Average, a busy machine does not replace what a compile costs
+			entry.duration = (entry.duration + durations[k]) / 2;
+			// Memory grows at once and shrinks slowly, an underestimate
+			// is an oom, 0 is a job without memory accounting
+			if (peakMemory[k] > entry.peakMemory) {
+				entry.peakMemory = peakMemory[k];
+			} else if (peakMemory[k] > 0) {
+				entry.peakMemory = (entry.peakMemory * 3 + peakMemory[k]) / 4;
+			};
+			history.set(keys[k], entry);
+		};
+
+		for (k = 0; k < history.length(); ++k) {
+			entry = history.arrayValue->index(k);
+			snprintf(buffer, sizeof(buffer), "%llu\t%llu\t", (unsigned long long)entry.duration, (unsigned long long)(entry.peakMemory / 1024));
+			content << buffer << history.arrayKey->index(k) << "\n";
+		};
+		if (!Shell::mkdirFilePath(historyFile)) {
+			return false;
+		};
+		snprintf(buffer, sizeof(buffer), ".tmp.%d", FileSystem::getProcessId());
+		tmpFile = historyFile + buffer;
+		if (!Shell::filePutContents(tmpFile, content)) {
+			return false;
+		};
+		Shell::remove(historyFile);
+		return FileSystem::renameFile(tmpFile, historyFile);
+	};
+
+};
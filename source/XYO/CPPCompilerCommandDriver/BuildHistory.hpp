@@ -0,0 +1,38 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_BUILDHISTORY_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_BUILDHISTORY_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::BuildHistory {
+
+	// History file lines are "<milliseconds>\t<peak KiB>\t<key>", key is the
+	// compile options and the source file, durations are averaged between runs
+
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String fileName(const String &tmpPath, const String &projectName);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String jobKey(int options, const String &srcFile);
+	// Expected milliseconds of each job, jobs without history are estimated
+	// from source size, scaled by the jobs with history, known counts those
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void expectedDurations(const String &historyFile, TDynamicArray<String> &keys, TDynamicArray<String> &srcFiles, TDynamicArray<uint64_t> &durations, size_t &known);
+	// Jobs by descending duration, equal durations keep list order
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void longestFirst(TDynamicArray<uint64_t> &durations, TDynamicArray<size_t> &order);
+	// Milliseconds to run jobs started in order on threads workers
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT uint64_t makespan(TDynamicArray<uint64_t> &durations, TDynamicArray<size_t> &order, int threads);
+	// Peak memory bytes of each job, 0 without history
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void expectedPeakMemory(const String &historyFile, TDynamicArray<String> &keys, TDynamicArray<uint64_t> &peakMemory, size_t &known);
+	// Peak memory bytes of the largest job, 0 without history
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT uint64_t largestPeakMemory(const String &historyFile);
+	// Jobs that ran the compiler, cache hits would lower the durations,
+	// peak memory 0 keeps the recorded one
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool record(const String &historyFile, TDynamicArray<String> &keys, TDynamicArray<uint64_t> &durations, TDynamicArray<uint64_t> &peakMemory);
+
+};
+
+#endif
@@ -0,0 +1,378 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/BuildTrace.hpp>
+#include <XYO/CPPCompilerCommandDriver/FileSystem.hpp>
+#include <XYO/CPPCompilerCommandDriver/Process.hpp>
+
+#include <XYO/CPPCompilerCommandDriver/BuildHistory.hpp>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace XYO::CPPCompilerCommandDriver::BuildTrace {
+
+	namespace BuildTraceX {
+
+		struct Job {
+				String category;
+				String name;
+				int exitStatus;
+				// milliseconds
+				uint64_t wallTime;
+				Process::Usage usage;
+		};
+
+		// Peak memory is the largest of a job
+		struct Total {
+				uint64_t jobs;
+				uint64_t wallTime;
+				Process::Usage usage;
+		};
+
+		static const size_t summaryTop = 10;
+
+		static CriticalSection lock;
+		static bool active = false;
+		static bool summaryActive = false;
+		static bool atExit = false;
+		static String traceFile;
+		static String summaryFile;
+		static TDynamicArray<String> events;
+		static TDynamicArray<Job> jobs;
+		static uint64_t origin = 0;
+		static int lanes = 0;
+		static thread_local int lane = -1;
+
+		static void appendEscaped(String &out, const char *value) {
+			char buffer[8];
+			for (; *value; ++value) {
+				switch (*value) {
+				case '"':
+					out << "\\\"";
+					break;
+				case '\\':
+					out << "\\\\";
+					break;
+				case '\n':
+					out << "\\n";
+					break;
+				case '\r':
+					out << "\\r";
+					break;
+				case '\t':
+					out << "\\t";
+					break;
+				default:
+					if ((unsigned char)*value < 0x20) {
+						snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned char)*value);
+						out << buffer;
+						break;
+					};
+					out << *value;
+					break;
+				};
+			};
+		};
+
+		// Lanes are numbered in order of their first job
+		static int currentLane() {
+			char buffer[128];
+			if (lane < 0) {
+				lock.enter();
+				lane = ++lanes;
+				snprintf(buffer, sizeof(buffer), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"lane %d\"}}", lane, lane);
+				events.push(buffer);
+				lock.leave();
+			};
+			return lane;
+		};
+
+		static void writeAtExit() {
+			write();
+		};
+
+		static void appendUsage(String &out, uint64_t wallTime, const Process::Usage &usage) {
+			char buffer[256];
+			snprintf(buffer, sizeof(buffer), "\"wallMs\":%llu,\"userMs\":%llu,\"systemMs\":%llu,\"peakMemory\":%llu,\"readBytes\":%llu,\"writtenBytes\":%llu",
+			         (unsigned long long)wallTime,
+			         (unsigned long long)usage.userTime,
+			         (unsigned long long)usage.systemTime,
+			         (unsigned long long)usage.peakMemory,
+			         (unsigned long long)usage.readBytes,
+			         (unsigned long long)usage.writtenBytes);
+			out << buffer;
+		};
+
+		static void appendJob(String &out, const Job &job) {
+			char buffer[64];
+			out << "{\"category\":\"";
+			appendEscaped(out, job.category.value());
+			out << "\",\"name\":\"";
+			appendEscaped(out, job.name.value());
+			snprintf(buffer, sizeof(buffer), "\",\"exit\":%d,", job.exitStatus);
+			out << buffer;
+			appendUsage(out, job.wallTime, job.usage);
+			out << "}";
+		};
+
+		static void appendJobList(String &out, TDynamicArray<size_t> &list, size_t count) {
+			size_t k;
+			out << "[";
+			for (k = 0; (k < list.length()) && (k < count); ++k) {
+				out << ((k > 0) ? ",\n" : "\n");
+				appendJob(out, jobs[list[k]]);
+			};
+			out << "\n]";
+		};
+
+		static void addTotal(Total &total, const Job &job) {
+			total.wallTime += job.wallTime;
+			total.usage.userTime += job.usage.userTime;
+			total.usage.systemTime += job.usage.systemTime;
+			total.usage.readBytes += job.usage.readBytes;
+			total.usage.writtenBytes += job.usage.writtenBytes;
+			if (job.usage.peakMemory > total.usage.peakMemory) {
+				total.usage.peakMemory = job.usage.peakMemory;
+			};
+			++total.jobs;
+		};
+
+		static bool writeTrace() {
+			FILE *out;
+			size_t k;
+
+			out = fopen(traceFile.value(), "wb");
+			if (!out) {
+				printf("Error: trace file not written - %s\n", traceFile.value());
+				return false;
+			};
+			fputs("{\"traceEvents\":[\n", out);
+			for (k = 0; k < events.length(); ++k) {
+				fputs(events[k].value(), out);
+				fputs((k + 1 < events.length()) ? ",\n" : "\n", out);
+			};
+			fputs("],\"displayTimeUnit\":\"ms\"}\n", out);
+			fclose(out);
+			return true;
+		};
+
+		// Top jobs by descending value, equal values keep job order
+		static void appendTop(String &out, TDynamicArray<uint64_t> &value) {
+			TDynamicArray<size_t> list;
+			BuildHistory::longestFirst(value, list);
+			appendJobList(out, list, summaryTop);
+		};
+
+		static bool writeSummary() {
+			// categories in order of their first job
+			TAssociativeArray<String, Total> categories;
+			TDynamicArray<uint64_t> wallTime;
+			TDynamicArray<uint64_t> peakMemory;
+			TDynamicArray<size_t> list;
+			String content;
+			char buffer[64];
+			Total total;
+			FILE *out;
+			size_t k;
+			size_t index;
+
+			total.jobs = 0;
+			total.wallTime = 0;
+			Process::clearUsage(total.usage);
+			for (k = 0; k < jobs.length(); ++k) {
+				if (!categories.getIndex(jobs[k].category, index)) {
+					categories.set(jobs[k].category, total);
+					categories.getIndex(jobs[k].category, index);
+				};
+				addTotal(categories.arrayValue->index(index), jobs[k]);
+				wallTime[k] = jobs[k].wallTime;
+				peakMemory[k] = jobs[k].usage.peakMemory;
+				list[k] = k;
+			};
+			for (k = 0; k < jobs.length(); ++k) {
+				addTotal(total, jobs[k]);
+			};
+
+			snprintf(buffer, sizeof(buffer), "{\"jobs\":%llu,\"total\":{", (unsigned long long)total.jobs);
+			content << buffer;
+			appendUsage(content, total.wallTime, total.usage);
+			content << "},\"categories\":{";
+			for (k = 0; k < categories.length(); ++k) {
+				Total &category = categories.arrayValue->index(k);
+				if (k > 0) {
+					content << ",";
+				};
+				content << "\n\"";
+				appendEscaped(content, categories.arrayKey->index(k).value());
+				snprintf(buffer, sizeof(buffer), "\":{\"jobs\":%llu,", (unsigned long long)category.jobs);
+				content << buffer;
+				appendUsage(content, category.wallTime, category.usage);
+				content << "}";
+			};
+			content << "\n},\"topByTime\":";
+			appendTop(content, wallTime);
+			content << ",\"topByMemory\":";
+			appendTop(content, peakMemory);
+			content << ",\"jobList\":";
+			appendJobList(content, list, list.length());
+			content << "}\n";
+
+			out = fopen(summaryFile.value(), "wb");
+			if (!out) {
+				printf("Error: job summary file not written - %s\n", summaryFile.value());
+				return false;
+			};
+			fputs(content.value(), out);
+			fclose(out);
+			return true;
+		};
+
+	};
+
+	using namespace BuildTraceX;
+
+	bool start(const String &fileName) {
+		if (fileName.isEmpty()) {
+			return false;
+		};
+		lock.enter();
+		if (!atExit) {
+			atexit(writeAtExit);
+			atExit = true;
+		};
+		traceFile = fileName;
+		events.empty();
+		origin = FileSystem::getMicroseconds();
+		active = true;
+		lock.leave();
+		return true;
+	};
+
+	bool startSummary(const String &fileName) {
+		if (fileName.isEmpty()) {
+			return false;
+		};
+		lock.enter();
+		if (!atExit) {
+			atexit(writeAtExit);
+			atExit = true;
+		};
+		summaryFile = fileName;
+		jobs.empty();
+		if (!active) {
+			origin = FileSystem::getMicroseconds();
+		};
+		summaryActive = true;
+		lock.leave();
+		return true;
+	};
+
+	bool isActive() {
+		bool retV;
+		lock.enter();
+		retV = active;
+		lock.leave();
+		return retV;
+	};
+
+	uint64_t now() {
+		return FileSystem::getMicroseconds() - origin;
+	};
+
+	void event(const char *category, const String &name, uint64_t begin, const String &command, int exitStatus, const String &outputFile) {
+		String item;
+		char buffer[256];
+		uint64_t end;
+		uint64_t outputSize = 0;
+		bool hasOutput = false;
+		bool isTrace;
+		bool isSummary;
+		int eventLane;
+		Job job;
+
+		lock.enter();
+		isTrace = active;
+		isSummary = summaryActive;
+		lock.leave();
+		if (!(isTrace || isSummary)) {
+			return;
+		};
+		end = now();
+		if (!command.isEmpty()) {
+			Process::getLastUsage(job.usage);
+			if (isSummary) {
+				job.category = category;
+				job.name = name;
+				job.exitStatus = exitStatus;
+				job.wallTime = (end - begin) / 1000;
+				lock.enter();
+				jobs.push(job);
+				lock.leave();
+			};
+		};
+		if (!isTrace) {
+			return;
+		};
+		eventLane = currentLane();
+		if (!outputFile.isEmpty()) {
+			hasOutput = FileSystem::getFileSize(outputFile, outputSize);
+		};
+
+		item << "{\"name\":\"";
+		appendEscaped(item, name.value());
+		item << "\",\"cat\":\"";
+		appendEscaped(item, category);
+		snprintf(buffer, sizeof(buffer), "\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%llu,\"dur\":%llu,\"args\":{\"exit\":%d",
+		         eventLane,
+		         (unsigned long long)begin,
+		         (unsigned long long)(end - begin),
+		         exitStatus);
+		item << buffer;
+		if (!command.isEmpty()) {
+			item << ",\"command\":\"";
+			appendEscaped(item, command.value());
+			item << "\"";
+		};
+		if (!outputFile.isEmpty()) {
+			item << ",\"output\":\"";
+			appendEscaped(item, outputFile.value());
+			item << "\"";
+		};
+		if (hasOutput) {
+			snprintf(buffer, sizeof(buffer), ",\"outputSize\":%llu", (unsigned long long)outputSize);
+			item << buffer;
+		};
+		if (!command.isEmpty()) {
+			item << ",";
+			appendUsage(item, (end - begin) / 1000, job.usage);
+		};
+		item << "}}";
+
+		lock.enter();
+		events.push(item);
+		lock.leave();
+	};
+
+	bool write() {
+		bool retV = true;
+
+		lock.enter();
+		if (!(active || summaryActive)) {
+			lock.leave();
+			return false;
+		};
+		if (active) {
+			retV = writeTrace() && retV;
+		};
+		if (summaryActive) {
+			retV = writeSummary() && retV;
+		};
+		lock.leave();
+		return retV;
+	};
+
+};
@@ -0,0 +1,36 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_BUILDTRACE_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_BUILDTRACE_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::BuildTrace {
+
+	// Jobs of the build in chrome trace event format (chrome://tracing,
+	// ui.perfetto.dev), one lane for each thread that runs jobs
+
+	// Record events, the file is written at exit
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool start(const String &fileName);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool isActive();
+	// Record the resources of each job that ran a command, the file is
+	// written at exit as json, totals by category and the jobs that took
+	// the most time and the most memory
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool startSummary(const String &fileName);
+	// Microseconds since start
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT uint64_t now();
+	// Job of the calling thread, from begin to now, output size is read
+	// from outputFile if there is one, with a command its resources are
+	// those of the last command the calling thread ran by Process::system
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void event(const char *category, const String &name, uint64_t begin, const String &command, int exitStatus, const String &outputFile);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool write();
+
+};
+
+#endif
@@ -0,0 +1,319 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/CacheServer.hpp>
+#include <XYO/CPPCompilerCommandDriver/CompileCache.hpp>
+#include <XYO/CPPCompilerCommandDriver/Digest.hpp>
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#ifndef XYO_PLATFORM_OS_WINDOWS
+#	include <unistd.h>
+#	include <signal.h>
+#	include <sys/socket.h>
+#	include <netinet/in.h>
+#	include <arpa/inet.h>
+#	include <sys/time.h>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::CacheServer {
+
+#ifdef XYO_PLATFORM_OS_WINDOWS
+
+	bool serve(const String &path, int port) {
+		printf("Error: cache server not available on this platform\n");
+		return false;
+	};
+
+#else
+
+	namespace CacheServerX {
+
+		// Connections served at once, one thread each
+		static const int serverThreads = 16;
+
+		struct Server {
+				int socket;
+				String path;
+		};
+
+		static bool sendAll(int socket, const char *data, size_t size) {
+			while (size > 0) {
+				ssize_t sent = send(socket, data, size, 0);
+				if (sent <= 0) {
+					return false;
+				};
+				data += sent;
+				size -= (size_t)sent;
+			};
+			return true;
+		};
+
+		static void sendStatus(int socket, const char *status) {
+			char buffer[256];
+			snprintf(buffer, sizeof(buffer), "HTTP/1.1 %s\r\nContent-Length: 0\r\nConnection: close\r\n\r\n", status);
+			sendAll(socket, buffer, strlen(buffer));
+		};
+
+		static bool isDigest(const String &value) {
+			const char *scan = value.value();
+			if (value.length() != 64) {
+				return false;
+			};
+			for (; *scan; ++scan) {
+				if (!(((*scan >= '0') && (*scan <= '9')) || ((*scan >= 'a') && (*scan <= 'f')))) {
+					return false;
+				};
+			};
+			return true;
+		};
+
+		// The blank line after the header, from start on
+		static bool findHeaderEnd(const char *data, size_t start, size_t size, size_t &headerEnd) {
+			size_t k;
+			for (k = start; k + 4 <= size; ++k) {
+				if (memcmp(&data[k], "\r\n\r\n", 4) == 0) {
+					headerEnd = k;
+					return true;
+				};
+			};
+			return false;
+		};
+
+		static void handle(int socket, const String &path) {
+			char request[65536];
+			char buffer[65536];
+			size_t size = 0;
+			size_t scanned = 0;
+			size_t headerEnd = 0;
+			size_t index;
+			size_t start;
+			ssize_t received;
+
+			while (!findHeaderEnd(request, scanned, size, headerEnd)) {
+				if (size >= sizeof(request)) {
+					sendStatus(socket, "431 Request Header Fields Too Large");
+					close(socket);
+					return;
+				};
+				received = recv(socket, &request[size], sizeof(request) - size, 0);
+				if (received <= 0) {
+					close(socket);
+					return;
+				};
+				// the blank line may start in the data scanned before
+				scanned = (size > 3) ? (size - 3) : 0;
+				size += (size_t)received;
+			};
+			// Body received with the header
+			const char *body = &request[headerEnd + 4];
+			size_t bodySize = size - (headerEnd + 4);
+			request[headerEnd] = 0;
+			String header = request;
+			String method;
+			String url;
+			if (!header.indexOf(" ", 0, index)) {
+				sendStatus(socket, "400 Bad Request");
+				close(socket);
+				return;
+			};
+			method = header.substring(0, index);
+			start = index + 1;
+			if (!header.indexOf(" ", start, index)) {
+				sendStatus(socket, "400 Bad Request");
+				close(socket);
+				return;
+			};
+			url = header.substring(start, index - start);
+
+			// Only /ac/<sha256> and /cas/<sha256>, nothing else is reachable
+			String kind;
+			String name;
+			if (url.beginWith("/ac/")) {
+				kind = "ac";
+				name = url.substring(4);
+			} else if (url.beginWith("/cas/")) {
+				kind = "cas";
+				name = url.substring(5);
+			};
+			if (kind.isEmpty() || !isDigest(name)) {
+				sendStatus(socket, "404 Not Found");
+				close(socket);
+				return;
+			};
+			String fileName = path + "/" + kind + "/" + name.substring(0, 2) + "/" + name;
+
+			if (method == "GET" || method == "HEAD") {
+				FILE *in = fopen(fileName.value(), "rb");
+				if (!in) {
+					sendStatus(socket, "404 Not Found");
+					close(socket);
+					return;
+				};
+				fseek(in, 0, SEEK_END);
+				long fileSize = ftell(in);
+				fseek(in, 0, SEEK_SET);
+				snprintf(buffer, sizeof(buffer), "HTTP/1.1 200 OK\r\nContent-Length: %ld\r\nContent-Type: application/octet-stream\r\nConnection: close\r\n\r\n", fileSize);
+				if (sendAll(socket, buffer, strlen(buffer)) && (method == "GET")) {
+					size_t ln;
+					while ((ln = fread(buffer, 1, sizeof(buffer), in)) > 0) {
+						if (!sendAll(socket, buffer, ln)) {
+							break;
+						};
+					};
+				};
+				fclose(in);
+				close(socket);
+				return;
+			};
+
+			if (method == "PUT") {
+				size_t contentLength = 0;
+				String upperHeader = header.toUpperCaseASCII();
+				if (!upperHeader.indexOf("\r\nCONTENT-LENGTH:", 0, index)) {
+					sendStatus(socket, "411 Length Required");
+					close(socket);
+					return;
+				};
+				contentLength = (size_t)strtoull(upperHeader.index(index + 17), nullptr, 10);
+				if (upperHeader.indexOf("\r\nEXPECT: 100-CONTINUE", 0, index)) {
+					const char *continueStatus = "HTTP/1.1 100 Continue\r\n\r\n";
+					sendAll(socket, continueStatus, strlen(continueStatus));
+				};
+
+				if (!Shell::mkdirFilePath(fileName)) {
+					sendStatus(socket, "500 Internal Server Error");
+					close(socket);
+					return;
+				};
+				String tmpFile = CompileCache::tmpFileName(fileName);
+				FILE *out = fopen(tmpFile.value(), "wb");
+				if (!out) {
+					sendStatus(socket, "500 Internal Server Error");
+					close(socket);
+					return;
+				};
+				size_t written = bodySize;
+				fwrite(body, 1, bodySize, out);
+				while (written < contentLength) {
+					received = recv(socket, buffer, sizeof(buffer), 0);
+					if (received <= 0) {
+						break;
+					};
+					fwrite(buffer, 1, (size_t)received, out);
+					written += (size_t)received;
+				};
+				fclose(out);
+				if (written != contentLength) {
+					Shell::remove(tmpFile);
+					close(socket);
+					return;
+				};
+				if (kind == "cas") {
+					String digest;
+					if (!Digest::sha256File(tmpFile, digest) || (digest != name)) {
+						Shell::remove(tmpFile);
+						sendStatus(socket, "400 Bad Request");
+						close(socket);
+						return;
+					};
+				};
+				if (!CompileCache::publish(tmpFile, fileName)) {
+					sendStatus(socket, "500 Internal Server Error");
+					close(socket);
+					return;
+				};
+				sendStatus(socket, "200 OK");
+				close(socket);
+				return;
+			};
+
+			sendStatus(socket, "405 Method Not Allowed");
+			close(socket);
+		};
+
+		// Each thread accepts and serves one connection at a time, a
+		// client that stops sending releases its thread at the timeout
+		static void serveConnections(void *this_) {
+			Server *server = (Server *)this_;
+			struct timeval timeout;
+			int client;
+			timeout.tv_sec = 30;
+			timeout.tv_usec = 0;
+			for (;;) {
+				client = accept(server->socket, nullptr, nullptr);
+				if (client < 0) {
+					continue;
+				};
+				setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+				setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+				handle(client, server->path);
+			};
+		};
+
+	};
+
+	bool serve(const String &path, int port) {
+		int server;
+		int option = 1;
+		struct sockaddr_in address;
+		CacheServerX::Server serverInfo;
+		Thread threads[CacheServerX::serverThreads];
+		int started;
+		int k;
+
+		signal(SIGPIPE, SIG_IGN);
+		if (!Shell::mkdirRecursivelyIfNotExists(path)) {
+			printf("Error: unable to create %s\n", path.value());
+			return false;
+		};
+
+		server = socket(AF_INET, SOCK_STREAM, 0);
+		if (server < 0) {
+			printf("Error: cache server socket\n");
+			return false;
+		};
+		setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &option, sizeof(option));
+		memset(&address, 0, sizeof(address));
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		address.sin_port = htons((uint16_t)port);
+		if (bind(server, (struct sockaddr *)&address, sizeof(address)) != 0) {
+			printf("Error: cache server bind port %d\n", port);
+			close(server);
+			return false;
+		};
+		if (listen(server, 64) != 0) {
+			printf("Error: cache server listen\n");
+			close(server);
+			return false;
+		};
+
+		printf("cache server http://127.0.0.1:%d %s\n", port, path.value());
+		fflush(stdout);
+		serverInfo.socket = server;
+		serverInfo.path = path;
+		for (started = 0; started < CacheServerX::serverThreads; ++started) {
+			if (!threads[started].start(CacheServerX::serveConnections, &serverInfo)) {
+				break;
+			};
+		};
+		if (started == 0) {
+			printf("Error: cache server thread\n");
+			close(server);
+			return false;
+		};
+		// Serves until the process is terminated
+		for (k = 0; k < started; ++k) {
+			threads[k].join();
+		};
+		return true;
+	};
+
+#endif
+
+};
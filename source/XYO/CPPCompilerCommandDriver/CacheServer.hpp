@@ -0,0 +1,22 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_CACHESERVER_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_CACHESERVER_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::CacheServer {
+
+	// Stand-in for a remote cache in tests, serves GET/HEAD/PUT of
+	// /ac/<sha256> and /cas/<sha256> from path on 127.0.0.1:port
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool serve(const String &path, int port);
+
+};
+
+#endif
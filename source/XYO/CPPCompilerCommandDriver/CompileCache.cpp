@@ -0,0 +1,713 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/CompileCache.hpp>
+#include <XYO/CPPCompilerCommandDriver/Digest.hpp>
+#include <XYO/CPPCompilerCommandDriver/FileSystem.hpp>
+#include <XYO/CPPCompilerCommandDriver/BuildHistory.hpp>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace XYO::CPPCompilerCommandDriver::CompileCache {
+
+	namespace CompileCacheX {
+
+		// Counters are shared by the compile threads
+		static CriticalSection counterLock;
+		static TAtomic<uint64_t> hits;
+		static TAtomic<uint64_t> misses;
+		static TAtomic<uint64_t> stores;
+		static TAtomic<uint64_t> evictions;
+		static TAtomic<uint64_t> evictedBytes;
+		static TAtomic<uint64_t> tmpIndex;
+		static TAtomic<uint64_t> restoredByClone;
+		static TAtomic<uint64_t> restoredByLink;
+		static TAtomic<uint64_t> restoredByCopy;
+		static TAtomic<uint64_t> linkHits;
+		static TAtomic<uint64_t> linkMisses;
+
+		// Temporary files of crashed processes are removed after one hour
+		static const int64_t staleTmpTime = 3600;
+		// store() publishes the diagnostics before the object, an entry
+		// without object is still being written for this long
+		static const int64_t incompleteEntryTime = 60;
+
+		static uint64_t count(TAtomic<uint64_t> &counter, uint64_t value) {
+			uint64_t retV;
+			counterLock.enter();
+			retV = counter.get() + value;
+			counter.set(retV);
+			counterLock.leave();
+			return retV;
+		};
+
+		struct Entry {
+				int64_t lastUse;
+				int64_t lastWrite;
+				uint64_t size;
+				bool hasObject;
+				// lastUse is from the access file
+				bool hasAccess;
+		};
+
+		// Uses of entries by other users, "key time" lines
+		static const char *accessFile = "/access";
+
+		// Time of the last use of entries by others than their owner
+		static void readAccess(const String &shardPath, TAssociativeArray<String, Entry> &entries) {
+			FILE *in;
+			char line[256];
+			char name[128];
+			long long time;
+			size_t index;
+			in = fopen((shardPath + accessFile).value(), "rb");
+			if (!in) {
+				return;
+			};
+			while (fgets(line, sizeof(line), in)) {
+				if (sscanf(line, "%127s %lld", name, &time) != 2) {
+					continue;
+				};
+				if (!entries.getIndex(name, index)) {
+					continue;
+				};
+				Entry &entry = entries.arrayValue->index(index);
+				if (entry.hasObject && (time > entry.lastUse)) {
+					entry.lastUse = time;
+					entry.hasAccess = true;
+				};
+			};
+			fclose(in);
+		};
+
+		// Keep the lines of entries left after eviction
+		static void writeAccess(const String &shardPath, TAssociativeArray<String, Entry> &entries) {
+			String content;
+			String tmpFile;
+			char buffer[32];
+			size_t k;
+			for (k = 0; k < entries.length(); ++k) {
+				Entry &entry = entries.arrayValue->index(k);
+				if (!entry.hasAccess) {
+					continue;
+				};
+				snprintf(buffer, sizeof(buffer), " %lld\n", (long long)entry.lastUse);
+				content << entries.arrayKey->index(k) << buffer;
+			};
+			if (content.isEmpty()) {
+				Shell::remove(shardPath + accessFile);
+				return;
+			};
+			tmpFile = tmpFileName(shardPath + accessFile);
+			if (!Shell::filePutContents(tmpFile, content)) {
+				Shell::remove(tmpFile);
+				return;
+			};
+			publish(tmpFile, shardPath + accessFile);
+		};
+
+		// Last write time of the entry is its last use, a shared cache
+		// entry belongs to the user that stored it, others can not touch
+		// it and append the use to the access file of the shard
+		static void touchEntry(const String &cachePath, const String &key) {
+			String entry = entryPath(cachePath, key);
+			FILE *out;
+			if (Shell::touchIfExists(entry + ".o")) {
+				return;
+			};
+			if (!Shell::fileExists(entry + ".o")) {
+				return;
+			};
+			// One short line, appends do not interleave
+			out = fopen((cachePath + "/" + key.substring(0, 2) + accessFile).value(), "ab");
+			if (!out) {
+				return;
+			};
+			fprintf(out, "%s %lld\n", key.value(), (long long)FileSystem::getTime());
+			fclose(out);
+		};
+
+	};
+
+	using namespace CompileCacheX;
+
+	// Clone shares blocks copy on write, hard link shares the file,
+	// only read-only entries are linked, the compiler removes the object
+	// before writing a new one so the entry is never written through the link
+	bool restoreFile(const String &entryFile, const String &objFile) {
+		Shell::remove(objFile);
+		if (FileSystem::cloneFile(entryFile, objFile)) {
+			count(restoredByClone, 1);
+			return true;
+		};
+		if (FileSystem::isReadOnly(entryFile)) {
+			if (FileSystem::linkFile(entryFile, objFile)) {
+				count(restoredByLink, 1);
+				return true;
+			};
+		};
+		if (Shell::copy(entryFile, objFile)) {
+			count(restoredByCopy, 1);
+			return true;
+		};
+		Shell::remove(objFile);
+		return false;
+	};
+
+	String tmpFileName(const String &fileName) {
+		char buffer[64];
+		snprintf(buffer, sizeof(buffer), ".tmp.%d.%llu", FileSystem::getProcessId(), (unsigned long long)count(tmpIndex, 1));
+		return fileName + buffer;
+	};
+
+	// Rename over an existing file fails on windows, the other copy is as good
+	bool publish(const String &tmpFile, const String &fileName) {
+		if (FileSystem::renameFile(tmpFile, fileName)) {
+			return true;
+		};
+		Shell::remove(tmpFile);
+		return Shell::fileExists(fileName);
+	};
+
+	String compilerIdentity(const String &compiler, const String &tmpPath) {
+		String versionFile;
+		String version;
+		String cmd;
+
+		versionFile = tmpPath + "/xyo-cc.compiler." + (Digest::sha256(compiler)).substring(0, 16) + ".txt";
+		if (!Shell::mkdirFilePath(versionFile)) {
+			return compiler;
+		};
+		cmd = compiler;
+		cmd << " --version > \"" << versionFile << "\" 2>&1";
+		if (Shell::system(cmd) != 0) {
+			return compiler;
+		};
+		cmd = compiler;
+		cmd << " -dumpmachine >> \"" << versionFile << "\" 2>&1";
+		Shell::system(cmd);
+		if (!Shell::fileGetContents(versionFile, version)) {
+			return compiler;
+		};
+		return Digest::sha256(compiler + "\n" + version);
+	};
+
+	String toolIdentity(const String &tool, const String &tmpPath) {
+		String versionFile;
+		String version;
+		String cmd;
+
+		versionFile = tmpPath + "/xyo-cc.tool." + (Digest::sha256(tool)).substring(0, 16) + ".txt";
+		if (!Shell::mkdirFilePath(versionFile)) {
+			return tool;
+		};
+		cmd = tool;
+		cmd << " --version > \"" << versionFile << "\" 2>&1";
+		if (Shell::system(cmd) != 0) {
+			return tool;
+		};
+		if (!Shell::fileGetContents(versionFile, version)) {
+			return tool;
+		};
+		return Digest::sha256(tool + "\n" + version);
+	};
+
+	String linkerIdentity(const String &compiler, const String &linker, const String &tmpPath) {
+		String pathFile;
+		String linkerPath;
+		String cmd;
+
+		pathFile = tmpPath + "/xyo-cc.linker." + (Digest::sha256(compiler + "\n" + linker)).substring(0, 16) + ".txt";
+		cmd = compiler;
+		cmd << " -print-prog-name=ld";
+		if (!linker.isEmpty()) {
+			cmd << "." << linker;
+		};
+		cmd << " > \"" << pathFile << "\"";
+		if (Shell::mkdirFilePath(pathFile)) {
+			if (Shell::system(cmd) == 0) {
+				if (Shell::fileGetContents(pathFile, linkerPath)) {
+					linkerPath = linkerPath.trimASCII();
+				};
+			};
+		};
+		if (linkerPath.isEmpty()) {
+			return compilerIdentity(compiler, tmpPath);
+		};
+		return Digest::sha256(compilerIdentity(compiler, tmpPath) + "\n" + toolIdentity("\"" + linkerPath + "\"", tmpPath));
+	};
+
+	bool makeLinkKey(const String &identity, const String &command, TDynamicArray<String> &inputs, const String &root, String &key) {
+		String digest;
+		String content;
+		size_t k;
+
+		content = "xyo-cc-link-1\n";
+		content << identity << "\n";
+		content << command << "\n";
+		for (k = 0; k < inputs.length(); ++k) {
+			if (!Digest::sha256File(inputs[k], digest)) {
+				return false;
+			};
+			content << digest << " " << inputs[k] << "\n";
+		};
+		if (!root.isEmpty()) {
+			content = content.replace(root, ".");
+		};
+		key = Digest::sha256(content);
+		return true;
+	};
+
+	String normalizeFlags(const String &flags) {
+		String retV;
+		size_t index;
+		size_t start = 0;
+		size_t end;
+
+		for (;;) {
+			if (!flags.indexOf(" -", start, index)) {
+				break;
+			};
+			if (index + 3 >= flags.length()) {
+				break;
+			};
+			if (!(((flags[index + 2] == 'I') || (flags[index + 2] == 'D')) && (flags[index + 3] == '"'))) {
+				retV << flags.substring(start, index + 2 - start);
+				start = index + 2;
+				continue;
+			};
+			retV << flags.substring(start, index - start);
+			if (!flags.indexOf("\"", index + 4, end)) {
+				start = flags.length();
+				break;
+			};
+			start = end + 1;
+		};
+		if (start < flags.length()) {
+			retV << flags.substring(start);
+		};
+		return retV;
+	};
+
+	bool makeKey(const String &identity, const String &flags, const String &preprocessedFile, const String &root, String &key) {
+		String digest;
+		String content;
+
+		// Line markers of headers under root are the only difference
+		// between checkouts of the same source
+		if (!root.isEmpty()) {
+			if (!Shell::fileGetContents(preprocessedFile, content)) {
+				return false;
+			};
+			digest = Digest::sha256(content.replace(root, "."));
+		} else if (!Digest::sha256File(preprocessedFile, digest)) {
+			return false;
+		};
+		content = "xyo-cc-cache-1\n";
+		content << identity << "\n";
+		content << flags << "\n";
+		content << digest << "\n";
+		key = Digest::sha256(content);
+		return true;
+	};
+
+	String entryPath(const String &cachePath, const String &key) {
+		return cachePath + "/" + key.substring(0, 2) + "/" + key;
+	};
+
+	void printDiagnostic(const String &diagnosticFile) {
+		String content;
+		if (!Shell::fileGetContents(diagnosticFile, content)) {
+			return;
+		};
+		if (content.length() > 0) {
+			fprintf(stderr, "%s", content.value());
+			fflush(stderr);
+		};
+	};
+
+	bool restore(const String &cachePath, const String &key, const String &objFile) {
+		String entry = entryPath(cachePath, key);
+
+		// The entry may be evicted by another process while copied
+		if (!Shell::fileExists(entry + ".o")) {
+			count(misses, 1);
+			return false;
+		};
+		if (!Shell::mkdirFilePath(objFile)) {
+			count(misses, 1);
+			return false;
+		};
+		if (!restoreFile(entry + ".o", objFile)) {
+			count(misses, 1);
+			return false;
+		};
+		touchEntry(cachePath, key);
+		Shell::touchIfExists(objFile);
+		printDiagnostic(entry + ".txt");
+		count(hits, 1);
+		return true;
+	};
+
+	bool restoreOutput(const String &cachePath, const String &key, const String &outFile) {
+		String entry = entryPath(cachePath, key);
+
+		if (!Shell::fileExists(entry + ".o")) {
+			count(linkMisses, 1);
+			return false;
+		};
+		if (!Shell::mkdirFilePath(outFile)) {
+			count(linkMisses, 1);
+			return false;
+		};
+		Shell::remove(outFile);
+		if (!FileSystem::cloneFile(entry + ".o", outFile)) {
+			if (!Shell::copy(entry + ".o", outFile)) {
+				Shell::remove(outFile);
+				count(linkMisses, 1);
+				return false;
+			};
+		};
+		FileSystem::copyMode(entry + ".o", outFile);
+		touchEntry(cachePath, key);
+		Shell::touchIfExists(outFile);
+		count(linkHits, 1);
+		return true;
+	};
+
+	bool store(const String &cachePath, uint64_t maxSize, const String &key, const String &objFile, const String &diagnosticFile) {
+		String entry = entryPath(cachePath, key);
+		String content;
+		String tmpFile;
+
+		if (!Shell::mkdirFilePath(entry)) {
+			return false;
+		};
+		if (!Shell::fileGetContents(diagnosticFile, content)) {
+			content = "";
+		};
+
+		// Diagnostics first, the object marks a complete entry
+		tmpFile = tmpFileName(entry + ".txt");
+		if (!Shell::filePutContents(tmpFile, content)) {
+			Shell::remove(tmpFile);
+			return false;
+		};
+		if (!publish(tmpFile, entry + ".txt")) {
+			return false;
+		};
+		tmpFile = tmpFileName(entry + ".o");
+		if (!FileSystem::cloneFile(objFile, tmpFile)) {
+			if (!Shell::copy(objFile, tmpFile)) {
+				Shell::remove(tmpFile);
+				return false;
+			};
+		};
+		FileSystem::copyMode(objFile, tmpFile);
+		Shell::touchIfExists(tmpFile);
+		FileSystem::setReadOnly(tmpFile);
+		if (!publish(tmpFile, entry + ".o")) {
+			return false;
+		};
+		count(stores, 1);
+
+		if (maxSize > 0) {
+			return evictShard(cachePath + "/" + key.substring(0, 2), maxSize / 256);
+		};
+		return true;
+	};
+
+	bool evictShard(const String &shardPath, uint64_t maxSize) {
+		TDynamicArray<String> files;
+		TAssociativeArray<String, Entry> entries;
+		TDynamicArray<uint64_t> age;
+		TDynamicArray<size_t> order;
+		Entry entry;
+		int64_t now = FileSystem::getTime();
+		uint64_t totalSize = 0;
+		uint64_t size;
+		int64_t lastWriteTime;
+		size_t k;
+		size_t index;
+
+		if (!FileSystem::listFiles(shardPath, files)) {
+			return false;
+		};
+		for (k = 0; k < files.length(); ++k) {
+			String fileName = shardPath + "/" + files[k];
+			if (!FileSystem::getFileSize(fileName, size)) {
+				continue;
+			};
+			if (!FileSystem::getLastWriteTime(fileName, lastWriteTime)) {
+				continue;
+			};
+			if (files[k].indexOf(".tmp.", 0, index)) {
+				if (now - lastWriteTime > staleTmpTime) {
+					Shell::remove(fileName);
+				};
+				continue;
+			};
+			if (!files[k].indexOf(".", 0, index)) {
+				continue;
+			};
+			String name = files[k].substring(0, index);
+			if (!entries.get(name, entry)) {
+				entry.lastUse = 0;
+				entry.lastWrite = 0;
+				entry.size = 0;
+				entry.hasObject = false;
+				entry.hasAccess = false;
+			};
+			entry.size += size;
+			if (files[k].endsWith(".o")) {
+				entry.hasObject = true;
+				entry.lastUse = lastWriteTime;
+			} else if (lastWriteTime > entry.lastWrite) {
+				entry.lastWrite = lastWriteTime;
+			};
+			entries.set(name, entry);
+			totalSize += size;
+		};
+
+		if (totalSize <= maxSize) {
+			return true;
+		};
+		readAccess(shardPath, entries);
+
+		// Evict down to 90% so the next store does not evict again
+		// Least recently used first, entries left without object before them
+		maxSize = maxSize - maxSize / 10;
+		for (k = 0; k < entries.length(); ++k) {
+			entry = entries.arrayValue->index(k);
+			age[k] = UINT64_MAX;
+			if (entry.hasObject) {
+				age[k] = (entry.lastUse < now) ? (uint64_t)(now - entry.lastUse) : 0;
+			};
+		};
+		BuildHistory::longestFirst(age, order);
+		for (k = 0; (k < order.length()) && (totalSize > maxSize); ++k) {
+			entry = entries.arrayValue->index(order[k]);
+			if ((!entry.hasObject) && (now - entry.lastWrite < incompleteEntryTime)) {
+				continue;
+			};
+			String fileName = shardPath + "/" + entries.arrayKey->index(order[k]);
+			Shell::remove(fileName + ".o");
+			Shell::remove(fileName + ".txt");
+			Shell::remove(fileName + ".ac");
+			totalSize -= entry.size;
+			entries.arrayValue->index(order[k]).hasAccess = false;
+			if (entry.hasObject) {
+				count(evictions, 1);
+				count(evictedBytes, entry.size);
+			};
+		};
+		writeAccess(shardPath, entries);
+		return true;
+	};
+
+	bool parseSize(const String &value, uint64_t &size) {
+		char *end = nullptr;
+		double number = strtod(value.value(), &end);
+		if (end == value.value()) {
+			return false;
+		};
+		switch (*end) {
+		case 'k':
+		case 'K':
+			number *= 1024.0;
+			break;
+		case 'm':
+		case 'M':
+			number *= 1024.0 * 1024.0;
+			break;
+		case 'g':
+		case 'G':
+			number *= 1024.0 * 1024.0 * 1024.0;
+			break;
+		case 0:
+			break;
+		default:
+			return false;
+		};
+		if (number < 0) {
+			return false;
+		};
+		size = (uint64_t)number;
+		return true;
+	};
+
+	String statistics() {
+		char buffer[256];
+		snprintf(buffer, sizeof(buffer), "hits %llu (clone %llu, link %llu, copy %llu), misses %llu, link hits %llu, link misses %llu, stored %llu, evicted %llu (%llu bytes)",
+		         (unsigned long long)hits.get(),
+		         (unsigned long long)restoredByClone.get(),
+		         (unsigned long long)restoredByLink.get(),
+		         (unsigned long long)restoredByCopy.get(),
+		         (unsigned long long)misses.get(),
+		         (unsigned long long)linkHits.get(),
+		         (unsigned long long)linkMisses.get(),
+		         (unsigned long long)stores.get(),
+		         (unsigned long long)evictions.get(),
+		         (unsigned long long)evictedBytes.get());
+		return buffer;
+	};
+
+	bool saveStatistics(const String &cachePath) {
+		FILE *out;
+		String fileName = cachePath + "/stats.txt";
+		if ((hits.get() + misses.get() + stores.get() + evictions.get()) == 0) {
+			return true;
+		};
+		if (!Shell::mkdirRecursivelyIfNotExists(cachePath)) {
+			return false;
+		};
+		// One short line per process, appends do not interleave
+		out = fopen(fileName.value(), "ab");
+		if (!out) {
+			return false;
+		};
+		fprintf(out, "%llu %llu %llu %llu %llu\n",
+		        (unsigned long long)hits.get(),
+		        (unsigned long long)misses.get(),
+		        (unsigned long long)stores.get(),
+		        (unsigned long long)evictions.get(),
+		        (unsigned long long)evictedBytes.get());
+		fclose(out);
+		return true;
+	};
+
+	bool showStatistics(const String &cachePath) {
+		FILE *in;
+		unsigned long long value[5];
+		unsigned long long total[5] = {0, 0, 0, 0, 0};
+		uint64_t entries = 0;
+		uint64_t totalSize = 0;
+		uint64_t size;
+		TDynamicArray<String> files;
+		char shard[3];
+		size_t k;
+		int m;
+
+		in = fopen((cachePath + "/stats.txt").value(), "rb");
+		if (in) {
+			while (fscanf(in, "%llu %llu %llu %llu %llu", &value[0], &value[1], &value[2], &value[3], &value[4]) == 5) {
+				for (m = 0; m < 5; ++m) {
+					total[m] += value[m];
+				};
+			};
+			fclose(in);
+		};
+
+		for (m = 0; m < 256; ++m) {
+			snprintf(shard, sizeof(shard), "%02x", m);
+			String shardPath = cachePath + "/" + shard;
+			if (!FileSystem::listFiles(shardPath, files)) {
+				continue;
+			};
+			for (k = 0; k < files.length(); ++k) {
+				if (FileSystem::getFileSize(shardPath + "/" + files[k], size)) {
+					totalSize += size;
+				};
+				if (files[k].endsWith(".o")) {
+					++entries;
+				};
+			};
+		};
+
+		printf("cache %s\n", cachePath.value());
+		printf("    entries   %llu\n", (unsigned long long)entries);
+		printf("    size      %llu\n", (unsigned long long)totalSize);
+		printf("    hits      %llu\n", total[0]);
+		printf("    misses    %llu\n", total[1]);
+		printf("    stored    %llu\n", total[2]);
+		printf("    evicted   %llu (%llu bytes)\n", total[3], total[4]);
+		return true;
+	};
+
+	bool benchmarkRestore(const String &cachePath, const String &tmpPath) {
+		const char *methodName[3] = {"copy", "link", "clone"};
+		TDynamicArray<String> files;
+		TDynamicArray<String> entries;
+		String benchPath = tmpPath + "/xyo-cc.cache-bench";
+		char shard[3];
+		size_t k;
+		int m;
+
+		for (m = 0; (m < 256) && (entries.length() < 1024); ++m) {
+			snprintf(shard, sizeof(shard), "%02x", m);
+			String shardPath = cachePath + "/" + shard;
+			if (!FileSystem::listFiles(shardPath, files)) {
+				continue;
+			};
+			for (k = 0; k < files.length(); ++k) {
+				if (files[k].endsWith(".o")) {
+					entries.push(shardPath + "/" + files[k]);
+				};
+			};
+		};
+		if (entries.length() == 0) {
+			printf("Error: cache is empty - %s\n", cachePath.value());
+			return false;
+		};
+		if (!Shell::mkdirRecursivelyIfNotExists(benchPath)) {
+			printf("Error: unable to create %s\n", benchPath.value());
+			return false;
+		};
+
+		printf("cache restore %s, %llu entries\n", cachePath.value(), (unsigned long long)entries.length());
+		for (m = 0; m < 3; ++m) {
+			uint64_t restored = 0;
+			uint64_t bytes = 0;
+			uint64_t size;
+			char objFile[32];
+			uint64_t start = FileSystem::getMicroseconds();
+			for (k = 0; k < entries.length(); ++k) {
+				bool ok;
+				snprintf(objFile, sizeof(objFile), "/%llu.o", (unsigned long long)k);
+				Shell::remove(benchPath + objFile);
+				switch (m) {
+				case 0:
+					ok = Shell::copy(entries[k], benchPath + objFile);
+					break;
+				case 1:
+					ok = FileSystem::linkFile(entries[k], benchPath + objFile);
+					break;
+				default:
+					ok = FileSystem::cloneFile(entries[k], benchPath + objFile);
+					break;
+				};
+				if (ok) {
+					++restored;
+					if (FileSystem::getFileSize(entries[k], size)) {
+						bytes += size;
+					};
+				};
+			};
+			double seconds = (double)(FileSystem::getMicroseconds() - start) / 1000000.0;
+			for (k = 0; k < entries.length(); ++k) {
+				snprintf(objFile, sizeof(objFile), "/%llu.o", (unsigned long long)k);
+				Shell::remove(benchPath + objFile);
+			};
+			if (restored == 0) {
+				printf("    %-6s not supported\n", methodName[m]);
+				continue;
+			};
+			if (seconds <= 0) {
+				seconds = 1e-9;
+			};
+			printf("    %-6s %llu files, %llu bytes, %.3f s, %.1f MiB/s, %.0f files/s\n",
+			       methodName[m],
+			       (unsigned long long)restored,
+			       (unsigned long long)bytes,
+			       seconds,
+			       (double)bytes / (1024.0 * 1024.0) / seconds,
+			       (double)restored / seconds);
+		};
+		return true;
+	};
+
+};
@@ -0,0 +1,54 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILECACHE_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_COMPILECACHE_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::CompileCache {
+
+	// Identity of a compiler command, digest of its version output
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String compilerIdentity(const String &compiler, const String &tmpPath);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String toolIdentity(const String &tool, const String &tmpPath);
+	// Identity of the compiler driver and of the linker it runs
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String linkerIdentity(const String &compiler, const String &linker, const String &tmpPath);
+	// Key of a link step, command is the response file, inputs are objects and libraries
+	// Paths under root, if not empty, are replaced by . in the key
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeLinkKey(const String &identity, const String &command, TDynamicArray<String> &inputs, const String &root, String &key);
+	// Include paths and defines are removed, their effect is in the preprocessed source
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String normalizeFlags(const String &flags);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeKey(const String &identity, const String &flags, const String &preprocessedFile, const String &root, String &key);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String entryPath(const String &cachePath, const String &key);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String tmpFileName(const String &fileName);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool publish(const String &tmpFile, const String &fileName);
+	// Restore by clone, by hard link of read-only entries or by copy
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool restoreFile(const String &entryFile, const String &objFile);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool restore(const String &cachePath, const String &key, const String &objFile);
+	// Link outputs are changed in place by strip, restored by clone or copy
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool restoreOutput(const String &cachePath, const String &key, const String &outFile);
+	// Entries are published by rename, readers take no lock,
+	// maxSize > 0 evicts least recently used entries of the entry shard,
+	// uses by others than the owner of an entry are read from the access
+	// file of the shard, in a shared cache the group must write the shards
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool store(const String &cachePath, uint64_t maxSize, const String &key, const String &objFile, const String &diagnosticFile);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void printDiagnostic(const String &diagnosticFile);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool evictShard(const String &shardPath, uint64_t maxSize);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool parseSize(const String &value, uint64_t &size);
+
+	// Counters of this process
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String statistics();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool saveStatistics(const String &cachePath);
+	// Totals of all processes and current cache size
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool showStatistics(const String &cachePath);
+	// Restore throughput of cache entries by copy, hard link and clone
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool benchmarkRestore(const String &cachePath, const String &tmpPath);
+
+};
+
+#endif
@@ -1,1329 +1,2744 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#include <XYO/CPPCompilerCommandDriver/CompilerGCC.hpp>
-
-namespace XYO::CPPCompilerCommandDriver {
-
-	CompilerGCC::CompilerGCC() {
-		type = CompilerType::GCC;
-		isOSWindows = false;
-		isOSLinux = false;
-		isOSEmscripten = false;
-		is32Bit = false;
-		is64Bit = false;
-		isStatic = false;
-	};
-
-	String CompilerGCC::objFilename(
-	    const String &project,
-	    const String &fileName,
-	    const String &tmpPath,
-	    int options,
-	    int index,
-	    int indexLn) {
-
-		options = filterOptions(options);
-
-		String strOptions;
-		if (options & CompilerOptions::Release) {
-			strOptions += "R";
-		};
-		if (options & CompilerOptions::Debug) {
-			strOptions += "D";
-		};
-		if (options & CompilerOptions::CRTStatic) {
-			strOptions += "S";
-		};
-		if (options & CompilerOptions::CRTDynamic) {
-			strOptions += "D";
-		};
-		if (options & CompilerOptions::StaticLibrary) {
-			strOptions += "S";
-		};
-		if (options & CompilerOptions::DynamicLibrary) {
-			strOptions += "D";
-		};
-
-		String retV = tmpPath;
-		retV << Shell::pathSeparator << Shell::getFileName(project) << ".";
-		retV << (NumberX::leftPadByDigits(index, indexLn)).value() << ".";
-		retV << strOptions << ".";
-		retV << Shell::getFileName(fileName) << ".o";
-
-		return retV;
-	};
-
-	bool CompilerGCC::cppToObj(
-	    int options,
-	    String cppFile,
-	    String objFile,
-	    TDynamicArray<String> &cppDefine,
-	    TDynamicArray<String> &incPath,
-	    int index,
-	    int indexLn,
-	    bool echoCmd) {
-		String cmd;
-		String content;
-
-		int k;
-		options = filterOptions(options);
-		if (!Shell::mkdirFilePath(objFile)) {
-			return false;
-		};
-
-		cppFile = cppFile.replace("\\", "/");
-		objFile = objFile.replace("\\", "/");
-		String cxx = Shell::getEnv("CXX");
-		if (cxx.length() == 0) {
-			cxx = "gcc";
-			if (isOSEmscripten) {
-				cxx = "emcc";
-			}
-		};
-		cmd = cxx;
-		content = " -O1 -std=c++17 -std=gnu++17 -fpermissive";
-		if (isOSEmscripten) {
-			content += " -pthread";
-		};
-		if (options & CompilerOptions::Release) {
-			content += " -DXYO_PLATFORM_COMPILE_RELEASE";
-		};
-		if (options & CompilerOptions::Debug) {
-			content += " -g";
-			content += " -DXYO_PLATFORM_COMPILE_DEBUG";
-		};
-		if (options & CompilerOptions::CRTStatic) {
-			content += " -DXYO_PLATFORM_COMPILE_CRT_STATIC";
-		};
-		if (options & CompilerOptions::CRTDynamic) {
-			content += " -DXYO_PLATFORM_COMPILE_CRT_DYNAMIC";
-		};
-		if (options & CompilerOptions::StaticLibrary) {
-			content += " -DXYO_PLATFORM_COMPILE_STATIC_LIBRARY";
-		};
-		if (options & CompilerOptions::DynamicLibrary) {
-			content += " -fpic";
-			if (isOSLinux) {
-				if (!isOSEmscripten) {
-					content += " -rdynamic";
-				};
-			};
-			if (options & CompilerOptions::DynamicLibraryXStatic) {
-				content += " -DXYO_PLATFORM_COMPILE_STATIC_LIBRARY";
-			} else {
-				content += " -DXYO_PLATFORM_COMPILE_DYNAMIC_LIBRARY";
-			};
-		};
-		for (k = 0; k < incPath.length(); ++k) {
-			content << " -I\"" << incPath[k].replace("\\", "/") << "\"";
-		};
-		for (k = 0; k < cppDefine.length(); ++k) {
-			content << " -D\"" << cppDefine[k] << "\"";
-		};
-		content << " -c -o \"" << objFile << "\"";
-		content << " \"" << cppFile << "\"";
-
-		String cmdFile = objFile.replace(".cpp.o", ".cpp2o");
-		Shell::filePutContents(cmdFile, content);
-		cmd << " @" << cmdFile;
-
-		if (echoCmd) {
-			printf("[%s/%d] %s\n", (NumberX::leftPadByDigits(index, indexLn)).value(), indexLn, cmd.value());
-		};
-		return (Shell::system(cmd) == 0);
-	};
-
-	bool CompilerGCC::makeObjToLib(
-	    String libName,
-	    String binPath,
-	    String libPath,
-	    String tmpPath,
-	    int options,
-	    TDynamicArray<String> &objFiles,
-	    String defFile,
-	    TDynamicArray<String> &libDependencyPath,
-	    TDynamicArray<String> &libDependency,
-	    String version,
-	    bool echoCmd,
-	    bool force) {
-		options = filterOptions(options);
-
-		String cmd;
-		int k;
-		String content;
-		String libNameOut;
-
-		if (objFiles.isEmpty()) {
-			return false;
-		};
-
-		if (!Shell::mkdirRecursivelyIfNotExists(binPath)) {
-			return false;
-		};
-		if (!Shell::mkdirRecursivelyIfNotExists(libPath)) {
-			return false;
-		};
-		if (!Shell::mkdirRecursivelyIfNotExists(tmpPath)) {
-			return false;
-		};
-
-		binPath = binPath.replace("\\", "/");
-		libPath = libPath.replace("\\", "/");
-		tmpPath = tmpPath.replace("\\", "/");
-
-		if (options & CompilerOptions::StaticLibrary) {
-			libNameOut = libPath + "/" + libName + ".a";
-			if (!force) {
-				if (!Shell::isChanged(libNameOut, objFiles)) {
-					return true;
-				};
-			};
-			Shell::remove(libNameOut);
-			for (k = 0; k < objFiles.length(); ++k) {
-				cmd = "ar qcs";
-				cmd << " \"" << libNameOut << "\"";
-				cmd << " \"" << objFiles[k].replace("\\", "/") << "\"";
-				if (echoCmd) {
-					printf("[%d/%d] %s\n", (int)(k + 1), (int)objFiles.length(), cmd.value());
-				};
-				if (Shell::system(cmd) != 0) {
-					Shell::remove(libNameOut);
-					return false;
-				};
-			};
-			return true;
-		};
-
-		if (options & CompilerOptions::DynamicLibrary) {
-			if (isOSLinux) {
-				libNameOut = binPath << "/" << libName << ".so";
-				if (!version.isEmpty()) {
-					libNameOut << "." << version;
-				};
-			};
-			if (isOSWindows) {
-				libNameOut = binPath << "/" << libName;
-				if (!version.isEmpty()) {
-					libNameOut << "-" << version;
-				};
-				libNameOut << ".dll";
-			};
-			if (!force) {
-				if (!Shell::isChanged(libNameOut, objFiles)) {
-					return true;
-				};
-			};
-
-			content << "-shared -o \"" << libNameOut << "\" -Wl,-rpath='$ORIGIN'";
-			if (!version.isEmpty()) {
-				if (isOSLinux) {
-					content << ",-soname," << libName << ".so." << version;
-				};
-				if (isOSWindows) {
-					content << ",-soname," << libName << "-" << version << ".dll";
-				};
-			};
-			for (k = 0; k < objFiles.length(); ++k) {
-				content << " \"" << objFiles[k].replace("\\", "/") << "\"";
-			};
-			for (k = 0; k < libDependencyPath.length(); ++k) {
-				if (isOSLinux) {
-					content << " -L\"" << libDependencyPath[k] << "\"";
-				};
-				if (isOSWindows) {
-					content << " -L\"" << libDependencyPath[k].replace("\\", "/") << "\"";
-				};
-			};
-			for (k = 0; k < libDependency.length(); ++k) {
-				if (libDependency[k][0] == ':') {
-					if (libDependency[k].endsWith(".static")) {
-						content << " -l" << libDependency[k] << ".a";
-						continue;
-					};
-					if (isOSLinux) {
-						if (isStatic) {
-							content << " -l" << libDependency[k] << ".a";
-						} else {
-							content << " -l" << libDependency[k] << ".so";
-						};
-					};
-					if (isOSWindows) {
-						if (isStatic) {
-							content << " -l" << libDependency[k] << ".a";
-						} else {
-							content << " -l" << libDependency[k] << ".dll";
-						}
-					};
-					continue;
-				};
-				content << " -l" << libDependency[k].replace("lib", "");
-			};
-			content << " -lstdc++";
-			content << " -lpthread";
-			content << " -lm";
-			if (isOSLinux) {
-				content << " -ldl";
-			};
-			if (isOSWindows) {
-				content << " -luser32 -lws2_32";
-			};
-
-			if (isOSEmscripten) {
-				content += " -s NODERAWFS=1 -pthread";
-			};
-
-			Shell::filePutContents(tmpPath + "/" + libName + ".o2so", content);
-			String cxx = Shell::getEnv("CXX");
-			if (cxx.length() == 0) {
-				cxx = "gcc";
-				if (isOSEmscripten) {
-					cxx = "emcc";
-				};
-			};
-			cmd = cxx + " @";
-			cmd << tmpPath + "/" + libName + ".o2so";
-			if (echoCmd) {
-				printf("%s\n", cmd.value());
-			};
-			if (Shell::system(cmd) == 0) {
-				if (isOSLinux) {
-					return Shell::copy(libNameOut, libPath + "/" + libName + ".so");
-				};
-				if (isOSWindows) {
-					return Shell::copy(libNameOut, libPath + "/" + libName + ".dll");
-				};
-			};
-			return false;
-		};
-
-		if (echoCmd) {
-			printf("%s\n", cmd.value());
-		};
-		if (Shell::system(cmd) == 0) {
-			return true;
-		};
-		return false;
-	};
-
-	bool CompilerGCC::makeObjToExe(
-	    String exeName,
-	    String binPath,
-	    String tmpPath,
-	    int options,
-	    TDynamicArray<String> &objFiles,
-	    TDynamicArray<String> &libDependencyPath,
-	    TDynamicArray<String> &libDependency,
-	    bool echoCmd,
-	    bool force) {
-		if (isOSWindows) {
-			options = filterOptions(options);
-		};
-
-		String cmd;
-		int k;
-		String content;
-		String exeNameOut;
-
-		if (objFiles.isEmpty()) {
-			return false;
-		};
-
-		if (!Shell::mkdirRecursivelyIfNotExists(binPath)) {
-			return false;
-		};
-		if (!Shell::mkdirRecursivelyIfNotExists(tmpPath)) {
-			return false;
-		};
-
-		binPath = binPath.replace("\\", "/");
-		tmpPath = tmpPath.replace("\\", "/");
-
-		exeNameOut = binPath << "/" << exeName;
-		if (isOSWindows) {
-			if (!exeNameOut.endsWith(".exe")) {
-				exeNameOut << ".exe";
-			};
-		};
-		if (!force) {
-			if (!Shell::isChanged(exeNameOut, objFiles)) {
-				return true;
-			};
-		};
-
-		if (isOSEmscripten) {
-			content += " -s NODERAWFS=1 -pthread ";
-			String exePreRUN = tmpPath + "/" + exeName + ".prerun.js";
-			String exePreRUNContent = "";
-			exePreRUNContent+="Module[\"preRun\"] = () => {\r\n";
-			exePreRUNContent+="\tif (ENVIRONMENT_IS_NODE) {\r\n";
-			exePreRUNContent+="\t\tif (typeof(ENV) !== 'undefined') {\r\n";
-			exePreRUNContent<<"\t\t\tENV['EMSCRIPTEN_PLATFORM'] = process.platform;\r\n";
-			exePreRUNContent<<"\t\t\tENV['TEMP'] = process.env.TEMP;\r\n";
-			// ---
-			String exeEnv = tmpPath + "/" + exeName + ".env";
-			if(Shell::fileExists(exeEnv)) {
-				String exeEnvContent;
-				if(Shell::fileGetContentsUTF8(exeEnv,exeEnvContent,UTFStreamMode::UTF8)) {
-					TDynamicArray<String> exeEnvList;
-					if(exeEnvContent.explode("\r", exeEnvList)) {
-						String line;
-						size_t k;																		
-						for(k=0;k<exeEnvList.length();++k) {
-							line=exeEnvList[k].trimASCII();
-							if(line.length()==0) {
-								continue;
-							};
-							if(line[0]=='#') {
-								continue;
-							};
-							exePreRUNContent<<"\t\t\tENV['"<<line<<"'] = process.env."<<line<<";\r\n";
-						};
-					};
-				};
-			};									
-			// ---
-			exePreRUNContent+="\t\t}\r\n";
-			exePreRUNContent+="\t}\r\n";
-			exePreRUNContent+="}\r\n";
-			Shell::filePutContentsUTF8(exePreRUN,exePreRUNContent,UTFStreamMode::UTF8);
-			content << " --pre-js \"" << exePreRUN << "\" ";					
-		};
-
-		content << "-o \"" << exeNameOut << "\" -Wl,-rpath='$ORIGIN'";
-		for (k = 0; k < objFiles.length(); ++k) {
-			content << " \"" << objFiles[k].replace("\\", "/") << "\"";
-		};
-		for (k = 0; k < libDependencyPath.length(); ++k) {
-			if (isOSLinux) {
-				content << " -L\"" << libDependencyPath[k] << "\"";
-			};
-			if (isOSWindows) {
-				content << " -L\"" << libDependencyPath[k].replace("\\", "/") << "\"";
-			};
-		};
-		for (k = 0; k < libDependency.length(); ++k) {
-			if (libDependency[k][0] == ':') {
-				if (libDependency[k].endsWith(".static")) {
-					content << " -l" << libDependency[k] << ".a";
-					continue;
-				};
-				if (isOSLinux) {
-					if (isStatic) {
-						content << " -l" << libDependency[k] << ".a";
-					} else {
-						content << " -l" << libDependency[k] << ".so";
-					};
-				};
-				if (isOSWindows) {
-					if (isStatic) {
-						content << " -l" << libDependency[k] << ".a";
-					} else {
-						content << " -l" << libDependency[k] << ".dll";
-					}
-				};
-				continue;
-			};
-			content << " -l" << libDependency[k].replace("lib", "");
-		};
-
-		if (isOSWindows) {
-			if (options & CompilerOptions::CRTStatic) {
-				content << " -static-libstdc++ -static-libgcc";
-				content << " -Wl,-Bstatic -lstdc++ -lpthread -lm -Wl,-Bdynamic";
-			} else {
-				content << " -lstdc++";
-				content << " -lpthread";
-				content << " -lm";
-			};
-			content << " -luser32 -lws2_32";
-		};
-		if (isOSLinux) {
-			content << " -lstdc++";
-			content << " -lpthread";
-			content << " -lm";
-			content << " -ldl";
-		};
-		Shell::filePutContents(tmpPath + "/" + exeName + ".o2elf", content);
-		String cxx = Shell::getEnv("CXX");
-		if (cxx.length() == 0) {
-			cxx = "gcc";
-			if (isOSEmscripten) {
-				cxx = "emcc";
-			};
-		};
-		cmd = cxx + " @";
-		cmd << tmpPath + "/" + exeName + ".o2elf";
-
-		if (echoCmd) {
-			printf("%s\n", cmd.value());
-		};
-		if (Shell::system(cmd) == 0) {
-			return true;
-		};
-		return false;
-	};
-
-	bool CompilerGCC::rcToRes(
-	    String rcFile,
-	    String resFile,
-	    TDynamicArray<String> &rcDefine,
-	    TDynamicArray<String> &incPath,
-	    bool echoCmd) {
-		if (isOSLinux) {
-			return false;
-		};
-		if (isOSWindows) {
-			String cmd;
-			int k;
-			if (!Shell::mkdirFilePath(resFile)) {
-				return false;
-			};
-
-			rcFile = rcFile.replace("\\", "/");
-			resFile = resFile.replace("\\", "/");
-			cmd = "windres ";
-			for (k = 0; k < incPath.length(); ++k) {
-				cmd << " -I \"" << incPath[k].replace("/", "\\") << "\"";
-			};
-			for (k = 0; k < rcDefine.length(); ++k) {
-				cmd << " --define \"" << rcDefine[k] << "\"";
-			};
-			cmd << " -l 409 -J rc -O res";
-			cmd << " -o \"" << resFile << "\"";
-			cmd << " -i \"" << rcFile << "\"";
-
-			if (echoCmd) {
-				printf("%s\n", cmd.value());
-			};
-			return (Shell::system(cmd) == 0);
-		};
-		return false;
-	};
-
-	bool CompilerGCC::resToObj(
-	    String resFile,
-	    String objFile,
-	    bool echoCmd) {
-		if (isOSLinux) {
-			return false;
-		};
-		if (isOSWindows) {
-			String cmd;
-			if (!Shell::mkdirFilePath(objFile)) {
-				return false;
-			};
-
-			resFile = resFile.replace("/", "\\");
-			objFile = objFile.replace("/", "\\");
-
-			cmd = "windres -J res -O coff";
-
-			cmd << " -o \"" << objFile << "\" -i \"" << resFile << "\"";
-
-			if (echoCmd) {
-				printf("%s\n", cmd.value());
-			};
-			return (Shell::system(cmd) == 0);
-		};
-
-		return false;
-	};
-
-	bool CompilerGCC::makeRcToObj(
-	    String rcFile,
-	    String objFile,
-	    TDynamicArray<String> &rcDefine,
-	    TDynamicArray<String> &incPath,
-	    bool echoCmd,
-	    bool force) {
-		if (isOSLinux) {
-			return false;
-		};
-		if (isOSWindows) {
-			bool toMake;
-
-			String resFile = objFile.replace(".o", ".res");
-			toMake = false;
-			if (!Shell::fileExists(resFile)) {
-				toMake = true;
-			} else {
-				if (Shell::compareLastWriteTime(resFile, rcFile) < 0) {
-					toMake = true;
-				};
-			};
-
-			if (toMake || force) {
-				if (!rcToRes(rcFile, resFile, rcDefine, incPath, echoCmd)) {
-					return false;
-				};
-			};
-
-			toMake = false;
-			if (!Shell::fileExists(objFile)) {
-				toMake = true;
-			} else {
-				if (Shell::compareLastWriteTime(objFile, resFile) < 0) {
-					toMake = true;
-				};
-			};
-
-			if (toMake || force) {
-				if (!resToObj(resFile, objFile, echoCmd)) {
-					return false;
-				};
-			};
-
-			return true;
-		};
-
-		return false;
-	}
-
-	namespace CompilerGCCWorker {
-
-		class CompilerWorkerBool : public Object {
-			public:
-				bool value;
-		};
-
-		TPointer<CompilerWorkerBool> compilerTransferWorkerBool(CompilerWorkerBool &value) {
-			TPointer<CompilerWorkerBool> retV;
-			retV.newMemory();
-			retV->value = value.value;
-			return retV;
-		};
-
-		class CompilerWorkerCppToObj : public Object {
-			public:
-				String cppFile;
-				String objFile;
-				int options;
-				TDynamicArray<String> incPath;
-				TDynamicArray<String> cppDefine;
-				int index;
-				int indexLn;
-				bool echoCmd;
-				CompilerGCC *super;
-		};
-
-		TPointer<CompilerWorkerCppToObj> compilerTransferWorkerCppToObj(CompilerWorkerCppToObj &value) {
-			TPointer<CompilerWorkerCppToObj> retV;
-			retV.newMemory();
-			retV->cppFile = value.cppFile.value();
-			retV->objFile = value.objFile.value();
-			retV->options = value.options;
-			size_t k;
-			TDynamicArray<String> *source;
-			TDynamicArray<String> *target;
-
-			source = &value.incPath;
-			target = &retV->incPath;
-			for (k = 0; k < source->length(); ++k) {
-				(target->index(k)) = (source->index(k)).value();
-			};
-
-			source = &value.cppDefine;
-			target = &retV->cppDefine;
-			for (k = 0; k < source->length(); ++k) {
-				(target->index(k)) = (source->index(k)).value();
-			};
-
-			retV->index = value.index;
-			retV->indexLn = value.indexLn;
-			retV->echoCmd = value.echoCmd;
-			retV->super = value.super;
-			return retV;
-		};
-
-		TPointer<CompilerWorkerBool> compilerWorkerProcedureCppToObj(CompilerWorkerCppToObj *parameter, TAtomic<bool> &requestToTerminate) {
-			TPointer<CompilerWorkerBool> retV;
-			retV.newMemory();
-			if (parameter) {
-				retV->value = parameter->super->cppToObj(
-				    parameter->options,
-				    parameter->cppFile,
-				    parameter->objFile,
-				    parameter->cppDefine,
-				    parameter->incPath,
-				    parameter->index,
-				    parameter->indexLn,
-				    parameter->echoCmd);
-			};
-			return retV;
-		};
-
-	};
-
-	bool CompilerGCC::makeCppToLib(
-	    String libName,
-	    String binPath,
-	    String libPath,
-	    String tmpPath,
-	    int options,
-	    TDynamicArray<String> &cppDefine,
-	    TDynamicArray<String> &incPath,
-	    TDynamicArray<String> &incFiles,
-	    TDynamicArray<String> &cppFiles,
-	    TDynamicArray<String> &rcDefine,
-	    TDynamicArray<String> &incPathRC,
-	    TDynamicArray<String> &rcFiles,
-	    String defFile,
-	    TDynamicArray<String> &libDependencyPath,
-	    TDynamicArray<String> &libDependency,
-	    String version,
-	    int numThreads,
-	    bool echoCmd,
-	    bool force) {
-		options = filterOptions(options);
-
-		size_t k, m;
-		TDynamicArray<String> objFiles;
-		TPointer<CompilerGCCWorker::CompilerWorkerCppToObj> parameter;
-		TPointer<CompilerGCCWorker::CompilerWorkerBool> retVCppToObj;
-		WorkerQueue compileCppToObj;
-		compileCppToObj.setNumberOfThreads(numThreads);
-		String projectName = libName;
-		bool toMakeCppToObj;
-
-		if (options & CompilerOptions::DynamicLibrary) {
-			projectName << ".so";
-		};
-		if (options & CompilerOptions::StaticLibrary) {
-			projectName << ".a";
-		};
-
-		TDynamicArray<FileTime> cppFilesTime;
-		TDynamicArray<FileTime> incFilesTime;
-		TDynamicArray<FileTime> objFilesTime;
-
-		for (k = 0; k < incFiles.length(); ++k) {
-			incFilesTime[k].getLastWriteTime(incFiles[k]);
-		};
-
-		for (k = 0; k < cppFiles.length(); ++k) {
-			objFiles[k] = objFilename(projectName, cppFiles[k], tmpPath, options, (k + 1), cppFiles.length());
-			cppFilesTime[k].getLastWriteTime(cppFiles[k]);
-			objFilesTime[k].getLastWriteTime(objFiles[k]);
-		};
-
-		for (k = 0; k < cppFiles.length(); ++k) {
-			toMakeCppToObj = false;
-			if (cppFilesTime[k].isChanged(incFilesTime)) {
-				Shell::touchIfExists(cppFiles[k]);
-				toMakeCppToObj = true;
-			};
-			if (!Shell::fileExists(objFiles[k])) {
-				toMakeCppToObj = true;
-			} else {
-				if (objFilesTime[k].compare(cppFilesTime[k]) < 0) {
-					toMakeCppToObj = true;
-				};
-			};
-
-			if (!force) {
-				if (!toMakeCppToObj) {
-					continue;
-				};
-			};
-
-			parameter.newMemory();
-			parameter->super = this;
-			parameter->cppFile = cppFiles[k];
-			parameter->objFile = objFiles[k];
-			parameter->options = options;
-			for (m = 0; m < incPath.length(); ++m) {
-				parameter->incPath[m] = incPath[m];
-			};
-			for (m = 0; m < cppDefine.length(); ++m) {
-				parameter->cppDefine[m] = cppDefine[m];
-			};
-			parameter->index = (k + 1);
-			parameter->indexLn = cppFiles.length();
-			parameter->echoCmd = echoCmd;
-			TWorkerQueue<CompilerGCCWorker::CompilerWorkerBool,
-			             CompilerGCCWorker::CompilerWorkerCppToObj,
-			             CompilerGCCWorker::compilerTransferWorkerBool,
-			             CompilerGCCWorker::compilerTransferWorkerCppToObj,
-			             CompilerGCCWorker::compilerWorkerProcedureCppToObj>::add(compileCppToObj, parameter);
-		};
-
-		if (!compileCppToObj.isEmpty()) {
-			if (!compileCppToObj.process()) {
-				return false;
-			};
-			for (k = 0; k < compileCppToObj.length(); ++k) {
-				retVCppToObj = TStaticCast<CompilerGCCWorker::CompilerWorkerBool *>(compileCppToObj.getReturnValue(k));
-				if (retVCppToObj) {
-					if (!retVCppToObj->value) {
-						return false;
-					};
-					continue;
-				};
-				return false;
-			};
-		};
-
-		if (isOSWindows) {
-			if (options & CompilerOptions::DynamicLibrary) {
-				String resObj;
-				for (k = 0; k < rcFiles.length(); ++k) {
-
-					if (Shell::isChanged(rcFiles[k], incFiles)) {
-						Shell::touchIfExists(rcFiles[k]);
-					};
-
-					resObj = objFilename(projectName, rcFiles[k], tmpPath, options, (k + 1), rcFiles.length());
-
-					if (!makeRcToObj(
-					        rcFiles[k],
-					        resObj,
-					        rcDefine,
-					        incPathRC,
-					        echoCmd,
-					        force)) {
-						return false;
-					};
-
-					objFiles.push(resObj);
-				};
-			};
-		};
-
-		return makeObjToLib(
-		    libName,
-		    binPath,
-		    libPath,
-		    tmpPath,
-		    options,
-		    objFiles,
-		    defFile,
-		    libDependencyPath,
-		    libDependency,
-		    version,
-		    echoCmd,
-		    force);
-	};
-
-	bool CompilerGCC::makeCppToExe(
-	    String exeName,
-	    String binPath,
-	    String tmpPath,
-	    int options,
-	    TDynamicArray<String> &cppDefine,
-	    TDynamicArray<String> &incPath,
-	    TDynamicArray<String> &incFiles,
-	    TDynamicArray<String> &cppFiles,
-	    TDynamicArray<String> &rcDefine,
-	    TDynamicArray<String> &incPathRC,
-	    TDynamicArray<String> &rcFiles,
-	    TDynamicArray<String> &libDependencyPath,
-	    TDynamicArray<String> &libDependency,
-	    int numThreads,
-	    bool echoCmd,
-	    bool force) {
-		options = filterOptions(options);
-
-		size_t k, m;
-		TDynamicArray<String> objFiles;
-		TPointer<CompilerGCCWorker::CompilerWorkerCppToObj> parameter;
-		TPointer<CompilerGCCWorker::CompilerWorkerBool> retVCppToObj;
-		WorkerQueue compileCppToObj;
-		compileCppToObj.setNumberOfThreads(numThreads);
-		String projectName = exeName;
-		bool toMakeCppToObj;
-
-		TDynamicArray<FileTime> cppFilesTime;
-		TDynamicArray<FileTime> incFilesTime;
-		TDynamicArray<FileTime> objFilesTime;
-
-		for (k = 0; k < incFiles.length(); ++k) {
-			incFilesTime[k].getLastWriteTime(incFiles[k]);
-		};
-
-		for (k = 0; k < cppFiles.length(); ++k) {
-			objFiles[k] = objFilename(projectName, cppFiles[k], tmpPath, options, (k + 1), cppFiles.length());
-			cppFilesTime[k].getLastWriteTime(cppFiles[k]);
-			objFilesTime[k].getLastWriteTime(objFiles[k]);
-		};
-
-		for (k = 0; k < cppFiles.length(); ++k) {
-			toMakeCppToObj = false;
-			if (cppFilesTime[k].isChanged(incFilesTime)) {
-				Shell::touchIfExists(cppFiles[k]);
-				toMakeCppToObj = true;
-			};
-			if (!Shell::fileExists(objFiles[k])) {
-				toMakeCppToObj = true;
-			} else {
-				if (objFilesTime[k].compare(cppFilesTime[k]) < 0) {
-					toMakeCppToObj = true;
-				};
-			};
-
-			if (!force) {
-				if (!toMakeCppToObj) {
-					continue;
-				};
-			};
-
-			parameter.newMemory();
-			parameter->super = this;
-			parameter->cppFile = cppFiles[k];
-			parameter->objFile = objFiles[k];
-			parameter->options = options;
-			for (m = 0; m < incPath.length(); ++m) {
-				parameter->incPath[m] = incPath[m];
-			};
-			for (m = 0; m < cppDefine.length(); ++m) {
-				parameter->cppDefine[m] = cppDefine[m];
-			};
-			parameter->index = (k + 1);
-			parameter->indexLn = cppFiles.length();
-			parameter->echoCmd = echoCmd;
-			TWorkerQueue<CompilerGCCWorker::CompilerWorkerBool,
-			             CompilerGCCWorker::CompilerWorkerCppToObj,
-			             CompilerGCCWorker::compilerTransferWorkerBool,
-			             CompilerGCCWorker::compilerTransferWorkerCppToObj,
-			             CompilerGCCWorker::compilerWorkerProcedureCppToObj>::add(compileCppToObj, parameter);
-		};
-
-		if (!compileCppToObj.isEmpty()) {
-			if (!compileCppToObj.process()) {
-				return false;
-			};
-			for (k = 0; k < compileCppToObj.length(); ++k) {
-				retVCppToObj = TStaticCast<CompilerGCCWorker::CompilerWorkerBool *>(compileCppToObj.getReturnValue(k));
-				if (retVCppToObj) {
-					if (!retVCppToObj->value) {
-						return false;
-					};
-					continue;
-				};
-				return false;
-			};
-		};
-
-		if (isOSWindows) {
-			String resObj;
-			for (k = 0; k < rcFiles.length(); ++k) {
-
-				if (Shell::isChanged(rcFiles[k], incFiles)) {
-					Shell::touchIfExists(rcFiles[k]);
-				};
-
-				resObj = objFilename(projectName, rcFiles[k], tmpPath, options, (k + 1), rcFiles.length());
-
-				if (!makeRcToObj(
-				        rcFiles[k],
-				        resObj,
-				        rcDefine,
-				        incPathRC,
-				        echoCmd,
-				        force)) {
-					return false;
-				};
-
-				objFiles.push(resObj);
-			};
-		};
-		return makeObjToExe(
-		    exeName,
-		    binPath,
-		    tmpPath,
-		    options,
-		    objFiles,
-		    libDependencyPath,
-		    libDependency,
-		    echoCmd,
-		    force);
-	};
-
-	bool CompilerGCC::cToObj(
-	    String cFile,
-	    String objFile,
-	    int options,
-	    TDynamicArray<String> &cDefine,
-	    TDynamicArray<String> &incPath,
-	    int index,
-	    int indexLn,
-	    bool echoCmd) {
-		String cmd;
-		String content;
-
-		int k;
-		options = filterOptions(options);
-		if (!Shell::mkdirFilePath(objFile)) {
-			return false;
-		};
-
-		cFile = cFile.replace("\\", "/");
-		objFile = objFile.replace("\\", "/");
-		String cc = Shell::getEnv("CC");
-		if (cc.length() == 0) {
-			cc = "gcc";
-			if (isOSEmscripten) {
-				cc = "emcc";
-			};
-		};
-		cmd = cc;
-		content = " -O1";
-		if (isOSEmscripten) {
-			content += " -pthread";
-		};
-		if (options & CompilerOptions::Release) {
-			content += " -DXYO_PLATFORM_COMPILE_RELEASE";
-		};
-		if (options & CompilerOptions::Debug) {
-			content += " -g";
-			content += " -DXYO_PLATFORM_COMPILE_DEBUG";
-		};
-		if (options & CompilerOptions::CRTStatic) {
-			content += " -DXYO_PLATFORM_COMPILE_CRT_STATIC";
-		};
-		if (options & CompilerOptions::CRTDynamic) {
-			content += " -DXYO_PLATFORM_COMPILE_CRT_DYNAMIC";
-		};
-		if (options & CompilerOptions::StaticLibrary) {
-			content += " -DXYO_PLATFORM_COMPILE_STATIC_LIBRARY";
-		};
-		if (options & CompilerOptions::DynamicLibrary) {
-			content += " -fpic";
-			if (isOSLinux) {
-				if (!isOSEmscripten) {
-					content += " -rdynamic";
-				};
-			};
-			if (options & CompilerOptions::DynamicLibraryXStatic) {
-				content += " -DXYO_PLATFORM_COMPILE_STATIC_LIBRARY";
-			} else {
-				content += " -DXYO_PLATFORM_COMPILE_DYNAMIC_LIBRARY";
-			};
-		};
-		for (k = 0; k < incPath.length(); ++k) {
-			content << " -I\"" << incPath[k].replace("\\", "/") << "\"";
-		};
-		for (k = 0; k < cDefine.length(); ++k) {
-			content << " -D\"" << cDefine[k] << "\"";
-		};
-		content << " -c -o \"" << objFile << "\"";
-		content << " \"" << cFile << "\"";
-
-		String cmdFile = objFile.replace(".c.o", ".c2o");
-		Shell::filePutContents(cmdFile, content);
-		cmd << " @" << cmdFile;
-
-		if (echoCmd) {
-			printf("[%d/%d] %s\n", index, indexLn, cmd.value());
-		};
-		return (Shell::system(cmd) == 0);
-	};
-
-	namespace CompilerGCCWorker {
-
-		TPointer<CompilerWorkerBool> compilerWorkerProcedureCToObj(CompilerWorkerCppToObj *parameter, TAtomic<bool> &requestToTerminate) {
-			TPointer<CompilerWorkerBool> retV;
-			retV.newMemory();
-			if (parameter) {
-				retV->value = parameter->super->cToObj(
-				    parameter->cppFile,
-				    parameter->objFile,
-				    parameter->options,
-				    parameter->cppDefine,
-				    parameter->incPath,
-				    parameter->index,
-				    parameter->indexLn,
-				    parameter->echoCmd);
-			};
-			return retV;
-		};
-
-	};
-
-	bool CompilerGCC::makeCToLib(
-	    String libName,
-	    String binPath,
-	    String libPath,
-	    String tmpPath,
-	    int options,
-	    TDynamicArray<String> &cDefine,
-	    TDynamicArray<String> &incPath,
-	    TDynamicArray<String> &incFiles,
-	    TDynamicArray<String> &cFiles,
-	    TDynamicArray<String> &rcDefine,
-	    TDynamicArray<String> &incPathRC,
-	    TDynamicArray<String> &rcFiles,
-	    String defFile,
-	    TDynamicArray<String> &libDependencyPath,
-	    TDynamicArray<String> &libDependency,
-	    String version,
-	    int numThreads,
-	    bool echoCmd,
-	    bool force) {
-		options = filterOptions(options);
-
-		size_t k, m;
-		TDynamicArray<String> objFiles;
-		TPointer<CompilerGCCWorker::CompilerWorkerCppToObj> parameter;
-		TPointer<CompilerGCCWorker::CompilerWorkerBool> retVCToObj;
-		WorkerQueue compileCToObj;
-		compileCToObj.setNumberOfThreads(numThreads);
-		String projectName = libName;
-		bool toMakeCToObj;
-
-		if (options & CompilerOptions::DynamicLibrary) {
-			projectName << ".so";
-		};
-		if (options & CompilerOptions::StaticLibrary) {
-			projectName << ".a";
-		};
-
-		TDynamicArray<FileTime> cFilesTime;
-		TDynamicArray<FileTime> incFilesTime;
-		TDynamicArray<FileTime> objFilesTime;
-
-		for (k = 0; k < incFiles.length(); ++k) {
-			incFilesTime[k].getLastWriteTime(incFiles[k]);
-		};
-
-		for (k = 0; k < cFiles.length(); ++k) {
-			objFiles[k] = objFilename(projectName, cFiles[k], tmpPath, options, (k + 1), cFiles.length());
-			cFilesTime[k].getLastWriteTime(cFiles[k]);
-			objFilesTime[k].getLastWriteTime(objFiles[k]);
-		};
-
-		for (k = 0; k < cFiles.length(); ++k) {
-			toMakeCToObj = false;
-			if (cFilesTime[k].isChanged(incFilesTime)) {
-				Shell::touchIfExists(cFiles[k]);
-				toMakeCToObj = true;
-			};
-			if (!Shell::fileExists(objFiles[k])) {
-				toMakeCToObj = true;
-			} else {
-				if (objFilesTime[k].compare(cFilesTime[k]) < 0) {
-					toMakeCToObj = true;
-				};
-			};
-
-			if (!force) {
-				if (!toMakeCToObj) {
-					continue;
-				};
-			};
-
-			parameter.newMemory();
-			parameter->super = this;
-			parameter->cppFile = cFiles[k];
-			parameter->objFile = objFiles[k];
-			parameter->options = options;
-			for (m = 0; m < incPath.length(); ++m) {
-				parameter->incPath[m] = incPath[m];
-			};
-			for (m = 0; m < cDefine.length(); ++m) {
-				parameter->cppDefine[m] = cDefine[m];
-			};
-			parameter->index = (k + 1);
-			parameter->indexLn = cFiles.length();
-			parameter->echoCmd = echoCmd;
-			TWorkerQueue<CompilerGCCWorker::CompilerWorkerBool,
-			             CompilerGCCWorker::CompilerWorkerCppToObj,
-			             CompilerGCCWorker::compilerTransferWorkerBool,
-			             CompilerGCCWorker::compilerTransferWorkerCppToObj,
-			             CompilerGCCWorker::compilerWorkerProcedureCToObj>::add(compileCToObj, parameter);
-		};
-
-		if (!compileCToObj.isEmpty()) {
-			if (!compileCToObj.process()) {
-				return false;
-			};
-			for (k = 0; k < compileCToObj.length(); ++k) {
-				retVCToObj = TStaticCast<CompilerGCCWorker::CompilerWorkerBool *>(compileCToObj.getReturnValue(k));
-				if (retVCToObj) {
-					if (!retVCToObj->value) {
-						return false;
-					};
-					continue;
-				};
-				return false;
-			};
-		};
-
-		if (isOSWindows) {
-			if (options & CompilerOptions::DynamicLibrary) {
-				String resObj;
-				for (k = 0; k < rcFiles.length(); ++k) {
-
-					if (Shell::isChanged(rcFiles[k], incFiles)) {
-						Shell::touchIfExists(rcFiles[k]);
-					};
-
-					resObj = objFilename(projectName, rcFiles[k], tmpPath, options, (k + 1), rcFiles.length());
-
-					if (!makeRcToObj(
-					        rcFiles[k],
-					        resObj,
-					        rcDefine,
-					        incPathRC,
-					        echoCmd,
-					        force)) {
-						return false;
-					};
-
-					objFiles.push(resObj);
-				};
-			};
-		};
-
-		return makeObjToLib(
-		    libName,
-		    binPath,
-		    libPath,
-		    tmpPath,
-		    options,
-		    objFiles,
-		    defFile,
-		    libDependencyPath,
-		    libDependency,
-		    version,
-		    echoCmd,
-		    force);
-	};
-
-	bool CompilerGCC::makeCToExe(
-	    String exeName,
-	    String binPath,
-	    String tmpPath,
-	    int options,
-	    TDynamicArray<String> &cDefine,
-	    TDynamicArray<String> &incPath,
-	    TDynamicArray<String> &incFiles,
-	    TDynamicArray<String> &cFiles,
-	    TDynamicArray<String> &rcDefine,
-	    TDynamicArray<String> &incPathRC,
-	    TDynamicArray<String> &rcFiles,
-	    TDynamicArray<String> &libDependencyPath,
-	    TDynamicArray<String> &libDependency,
-	    int numThreads,
-	    bool echoCmd,
-	    bool force) {
-		options = filterOptions(options);
-
-		size_t k, m;
-		TDynamicArray<String> objFiles;
-		TPointer<CompilerGCCWorker::CompilerWorkerCppToObj> parameter;
-		TPointer<CompilerGCCWorker::CompilerWorkerBool> retVCToObj;
-		WorkerQueue compileCToObj;
-		compileCToObj.setNumberOfThreads(numThreads);
-		String projectName = exeName;
-		bool toMakeCToObj;
-
-		TDynamicArray<FileTime> cFilesTime;
-		TDynamicArray<FileTime> incFilesTime;
-		TDynamicArray<FileTime> objFilesTime;
-
-		for (k = 0; k < incFiles.length(); ++k) {
-			incFilesTime[k].getLastWriteTime(incFiles[k]);
-		};
-
-		for (k = 0; k < cFiles.length(); ++k) {
-			objFiles[k] = objFilename(projectName, cFiles[k], tmpPath, options, (k + 1), cFiles.length());
-			cFilesTime[k].getLastWriteTime(cFiles[k]);
-			objFilesTime[k].getLastWriteTime(objFiles[k]);
-		};
-
-		for (k = 0; k < cFiles.length(); ++k) {
-			toMakeCToObj = false;
-			if (cFilesTime[k].isChanged(incFilesTime)) {
-				Shell::touchIfExists(cFiles[k]);
-				toMakeCToObj = true;
-			};
-			if (!Shell::fileExists(objFiles[k])) {
-				toMakeCToObj = true;
-			} else {
-				if (objFilesTime[k].compare(cFilesTime[k]) < 0) {
-					toMakeCToObj = true;
-				};
-			};
-
-			if (!force) {
-				if (!toMakeCToObj) {
-					continue;
-				};
-			};
-
-			parameter.newMemory();
-			parameter->cppFile = cFiles[k];
-			parameter->objFile = objFiles[k];
-			parameter->options = options;
-			for (m = 0; m < incPath.length(); ++m) {
-				parameter->incPath[m] = incPath[m];
-			};
-			for (m = 0; m < cDefine.length(); ++m) {
-				parameter->cppDefine[m] = cDefine[m];
-			};
-			parameter->index = (k + 1);
-			parameter->indexLn = cFiles.length();
-			parameter->echoCmd = echoCmd;
-			TWorkerQueue<CompilerGCCWorker::CompilerWorkerBool,
-			             CompilerGCCWorker::CompilerWorkerCppToObj,
-			             CompilerGCCWorker::compilerTransferWorkerBool,
-			             CompilerGCCWorker::compilerTransferWorkerCppToObj,
-			             CompilerGCCWorker::compilerWorkerProcedureCToObj>::add(compileCToObj, parameter);
-		};
-
-		if (!compileCToObj.isEmpty()) {
-			if (!compileCToObj.process()) {
-				return false;
-			};
-			for (k = 0; k < compileCToObj.length(); ++k) {
-				retVCToObj = TStaticCast<CompilerGCCWorker::CompilerWorkerBool *>(compileCToObj.getReturnValue(k));
-				if (retVCToObj) {
-					if (!retVCToObj->value) {
-						return false;
-					};
-					continue;
-				};
-				return false;
-			};
-		};
-		if (isOSWindows) {
-			String resObj;
-			for (k = 0; k < rcFiles.length(); ++k) {
-
-				if (Shell::isChanged(rcFiles[k], incFiles)) {
-					Shell::touchIfExists(rcFiles[k]);
-				};
-
-				resObj = objFilename(projectName, rcFiles[k], tmpPath, options, (k + 1), rcFiles.length());
-
-				if (!makeRcToObj(
-				        rcFiles[k],
-				        resObj,
-				        rcDefine,
-				        incPathRC,
-				        echoCmd,
-				        force)) {
-					return false;
-				};
-
-				objFiles.push(resObj);
-			};
-		};
-
-		return makeObjToExe(
-		    exeName,
-		    binPath,
-		    tmpPath,
-		    options,
-		    objFiles,
-		    libDependencyPath,
-		    libDependency,
-		    echoCmd,
-		    force);
-	};
-
-};
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/CompilerGCC.hpp>
+#include <XYO/CPPCompilerCommandDriver/Digest.hpp>
+#include <XYO/CPPCompilerCommandDriver/DepFile.hpp>
+#include <XYO/CPPCompilerCommandDriver/FileSystem.hpp>
+#include <XYO/CPPCompilerCommandDriver/ModuleDependency.hpp>
+#include <XYO/CPPCompilerCommandDriver/CompileCache.hpp>
+#include <XYO/CPPCompilerCommandDriver/RemoteCache.hpp>
+#include <XYO/CPPCompilerCommandDriver/BuildHistory.hpp>
+#include <XYO/CPPCompilerCommandDriver/JobServer.hpp>
+#include <XYO/CPPCompilerCommandDriver/MemoryBudget.hpp>
+#include <XYO/CPPCompilerCommandDriver/LoadLimit.hpp>
+#include <XYO/CPPCompilerCommandDriver/Process.hpp>
+#include <XYO/CPPCompilerCommandDriver/BuildTrace.hpp>
+
+namespace XYO::CPPCompilerCommandDriver {
+
+	CompilerGCC::CompilerGCC() {
+		type = CompilerType::GCC;
+		isOSWindows = false;
+		isOSLinux = false;
+		isOSEmscripten = false;
+		is32Bit = false;
+		is64Bit = false;
+		isStatic = false;
+		hugePageText = false;
+		splitDebug = false;
+		modules = false;
+		cacheSize = 0;
+		lto = false;
+		failFast = false;
+		keepGoing = false;
+	};
+
+	String CompilerGCC::objFilename(
+	    const String &project,
+	    const String &fileName,
+	    const String &tmpPath,
+	    int options,
+	    int index,
+	    int indexLn) {
+
+		options = filterOptions(options);
+
+		String strOptions;
+		if (options & CompilerOptions::Release) {
+			strOptions += "R";
+		};
+		if (options & CompilerOptions::Debug) {
+			strOptions += "D";
+		};
+		if (options & CompilerOptions::CRTStatic) {
+			strOptions += "S";
+		};
+		if (options & CompilerOptions::CRTDynamic) {
+			strOptions += "D";
+		};
+		if (options & CompilerOptions::StaticLibrary) {
+			strOptions += "S";
+		};
+		if (options & CompilerOptions::DynamicLibrary) {
+			strOptions += "D";
+		};
+
+		String retV = tmpPath;
+		retV << Shell::pathSeparator << Shell::getFileName(project) << ".";
+		// Named by the source path, not by its position in the list, so
+		// adding or removing a source leaves the other objects up to date
+		retV << Digest::sha256(fileName.replace("\\", "/")).substring(0, 8) << ".";
+		retV << strOptions << ".";
+		retV << Shell::getFileName(fileName) << ".o";
+
+		return retV;
+	};
+
+	int CompilerGCC::runCommand(
+	    const char *category,
+	    String name,
+	    String cmd,
+	    String outputFile) {
+		uint64_t begin = BuildTrace::now();
+		int retV = Process::system(cmd, false);
+		BuildTrace::event(category, name, begin, cmd, retV, outputFile);
+		return retV;
+	};
+
+	String CompilerGCC::cxxCommand() {
+		String cxx = Shell::getEnv("CXX");
+		if (cxx.length() == 0) {
+			cxx = "gcc";
+			if (isOSEmscripten) {
+				cxx = "emcc";
+			};
+		};
+		return cxx;
+	};
+
+	String CompilerGCC::ccCommand() {
+		String cc = Shell::getEnv("CC");
+		if (cc.length() == 0) {
+			cc = "gcc";
+			if (isOSEmscripten) {
+				cc = "emcc";
+			};
+		};
+		return cc;
+	};
+
+	String CompilerGCC::linkerName() {
+		if (linker.isEmpty() && (!symbolOrderingFile.isEmpty())) {
+			return "lld";
+		};
+		return linker;
+	};
+
+	String CompilerGCC::arCommand() {
+		// gcc-ar loads the lto plugin to index lto objects
+		String ar = "ar";
+		if (lto) {
+			ar = "gcc-ar";
+		};
+		// D stores zero timestamps, uids and modes in the archive
+		if (!reproducibleRoot.isEmpty()) {
+			return ar + " qcsD";
+		};
+		return ar + " qcs";
+	};
+
+	String CompilerGCC::ltoLinkFlags() {
+		if (!lto) {
+			return "";
+		};
+		// Without a jobserver gcc uses one partition job per cpu
+		if (JobServer::isActive()) {
+			return " -flto=jobserver";
+		};
+		return " -flto=auto";
+	};
+
+	String CompilerGCC::reproducibleFlags() {
+		String content;
+		if (reproducibleRoot.isEmpty()) {
+			return content;
+		};
+		content << " -ffile-prefix-map=\"" << reproducibleRoot << "\"=.";
+		content << " -fdebug-prefix-map=\"" << reproducibleRoot << "\"=.";
+		return content;
+	};
+
+	String CompilerGCC::reproduciblePath(const String &value) {
+		if (reproducibleRoot.isEmpty()) {
+			return value;
+		};
+		return value.replace(reproducibleRoot, ".");
+	};
+
+	String CompilerGCC::cppFlags(
+	    int options,
+	    TDynamicArray<String> &cppDefine,
+	    TDynamicArray<String> &incPath) {
+		String content;
+
+		int k;
+		options = filterOptions(options);
+
+		content = " -O1 -std=c++17 -std=gnu++17 -fpermissive";
+		if (!standard.isEmpty()) {
+			content = " -O1 -std=";
+			content << standard << " -fpermissive";
+		};
+		if (isOSEmscripten) {
+			content += " -pthread";
+		};
+		if (options & CompilerOptions::ISALevel) {
+			content << " -march=" << isaLevelName(options);
+		};
+		if (!symbolOrderingFile.isEmpty()) {
+			content += " -ffunction-sections";
+		};
+		if (options & CompilerOptions::Release) {
+			content += " -DXYO_PLATFORM_COMPILE_RELEASE";
+		};
+		if (options & CompilerOptions::Debug) {
+			content += " -g";
+			content += " -DXYO_PLATFORM_COMPILE_DEBUG";
+		};
+		if (options & CompilerOptions::CRTStatic) {
+			content += " -DXYO_PLATFORM_COMPILE_CRT_STATIC";
+		};
+		if (options & CompilerOptions::CRTDynamic) {
+			content += " -DXYO_PLATFORM_COMPILE_CRT_DYNAMIC";
+		};
+		if (options & CompilerOptions::StaticLibrary) {
+			content += " -DXYO_PLATFORM_COMPILE_STATIC_LIBRARY";
+		};
+		if (options & CompilerOptions::DynamicLibrary) {
+			content += " -fpic";
+			if (isOSLinux) {
+				if (!isOSEmscripten) {
+					content += " -rdynamic";
+				};
+			};
+			if (options & CompilerOptions::DynamicLibraryXStatic) {
+				content += " -DXYO_PLATFORM_COMPILE_STATIC_LIBRARY";
+			} else {
+				content += " -DXYO_PLATFORM_COMPILE_DYNAMIC_LIBRARY";
+			};
+		};
+		if (lto) {
+			content += " -flto";
+		};
+		content << reproducibleFlags();
+		for (k = 0; k < incPath.length(); ++k) {
+			content << " -I\"" << incPath[k].replace("\\", "/") << "\"";
+		};
+		for (k = 0; k < cppDefine.length(); ++k) {
+			content << " -D\"" << cppDefine[k] << "\"";
+		};
+		return content;
+	};
+
+	String CompilerGCC::cFlags(
+	    int options,
+	    TDynamicArray<String> &cDefine,
+	    TDynamicArray<String> &incPath) {
+		String content;
+
+		int k;
+		options = filterOptions(options);
+
+		content = " -O1";
+		if (isOSEmscripten) {
+			content += " -pthread";
+		};
+		if (options & CompilerOptions::ISALevel) {
+			content << " -march=" << isaLevelName(options);
+		};
+		if (!symbolOrderingFile.isEmpty()) {
+			content += " -ffunction-sections";
+		};
+		if (options & CompilerOptions::Release) {
+			content += " -DXYO_PLATFORM_COMPILE_RELEASE";
+		};
+		if (options & CompilerOptions::Debug) {
+			content += " -g";
+			content += " -DXYO_PLATFORM_COMPILE_DEBUG";
+		};
+		if (options & CompilerOptions::CRTStatic) {
+			content += " -DXYO_PLATFORM_COMPILE_CRT_STATIC";
+		};
+		if (options & CompilerOptions::CRTDynamic) {
+			content += " -DXYO_PLATFORM_COMPILE_CRT_DYNAMIC";
+		};
+		if (options & CompilerOptions::StaticLibrary) {
+			content += " -DXYO_PLATFORM_COMPILE_STATIC_LIBRARY";
+		};
+		if (options & CompilerOptions::DynamicLibrary) {
+			content += " -fpic";
+			if (isOSLinux) {
+				if (!isOSEmscripten) {
+					content += " -rdynamic";
+				};
+			};
+			if (options & CompilerOptions::DynamicLibraryXStatic) {
+				content += " -DXYO_PLATFORM_COMPILE_STATIC_LIBRARY";
+			} else {
+				content += " -DXYO_PLATFORM_COMPILE_DYNAMIC_LIBRARY";
+			};
+		};
+		if (lto) {
+			content += " -flto";
+		};
+		content << reproducibleFlags();
+		for (k = 0; k < incPath.length(); ++k) {
+			content << " -I\"" << incPath[k].replace("\\", "/") << "\"";
+		};
+		for (k = 0; k < cDefine.length(); ++k) {
+			content << " -D\"" << cDefine[k] << "\"";
+		};
+		return content;
+	};
+
+	String CompilerGCC::compileFlags(
+	    bool isCSource,
+	    int options,
+	    TDynamicArray<String> &define,
+	    TDynamicArray<String> &incPath) {
+		String content;
+
+		if (isCSource) {
+			return cFlags(options, define, incPath);
+		};
+		content = cppFlags(options, define, incPath);
+		if (!precompiledHeaderInclude.isEmpty()) {
+			content << " -include \"" << precompiledHeaderInclude << "\" -Winvalid-pch";
+		};
+		if (!moduleMapper.isEmpty()) {
+			content << " -fmodules-ts -fmodule-mapper=\"" << moduleMapper << "\" -x c++";
+		};
+		return content;
+	};
+
+	String CompilerGCC::compileCmdFile(
+	    bool isCSource,
+	    String objFile) {
+		String retV;
+
+		objFile = objFile.replace("\\", "/");
+		if (isCSource) {
+			retV = objFile.replace(".c.o", ".c2o");
+		} else {
+			retV = objFile.replace(".cpp.o", ".cpp2o");
+		};
+		if (retV == objFile) {
+			retV = objFile + "2o";
+		};
+		return retV;
+	};
+
+	bool CompilerGCC::isCmdFileChanged(
+	    String cmdFile,
+	    const String &content) {
+		String previous;
+
+		if (!Shell::fileGetContents(cmdFile, previous)) {
+			return true;
+		};
+		return (content != previous);
+	};
+
+	bool CompilerGCC::isCompileChanged(
+	    bool isCSource,
+	    int options,
+	    TDynamicArray<String> &define,
+	    TDynamicArray<String> &incPath,
+	    String sourceFile,
+	    String objFile) {
+		String content;
+
+		objFile = objFile.replace("\\", "/");
+		content = compileFlags(isCSource, options, define, incPath);
+		content << " -c -o \"" << objFile << "\"";
+		content << " \"" << sourceFile.replace("\\", "/") << "\"";
+		return isCmdFileChanged(compileCmdFile(isCSource, objFile), content);
+	};
+
+	bool CompilerGCC::cppToObj(
+	    int options,
+	    String cppFile,
+	    String objFile,
+	    TDynamicArray<String> &cppDefine,
+	    TDynamicArray<String> &incPath,
+	    int index,
+	    int indexLn,
+	    bool echoCmd) {
+		String cmd;
+		String content;
+
+		if (!Shell::mkdirFilePath(objFile)) {
+			return false;
+		};
+
+		cppFile = cppFile.replace("\\", "/");
+		objFile = objFile.replace("\\", "/");
+		cmd = cxxCommand();
+		content = compileFlags(false, options, cppDefine, incPath);
+		String cmdFile = compileCmdFile(false, objFile);
+
+		char label[64];
+		snprintf(label, sizeof(label), "[%s/%d]", (NumberX::leftPadByDigits(index, indexLn)).value(), indexLn);
+		return compileToObj(cmd, content, cppFile, objFile, cmdFile, label, echoCmd);
+	};
+
+	bool CompilerGCC::compileToObj(
+	    String cmd,
+	    String flags,
+	    String sourceFile,
+	    String objFile,
+	    String cmdFile,
+	    String label,
+	    bool echoCmd) {
+		String content;
+		String compile;
+		String key;
+		size_t index;
+		bool useCache;
+		bool retV;
+		int status;
+		uint64_t begin;
+
+		content = flags;
+		content << " -c -o \"" << objFile << "\"";
+		content << " \"" << sourceFile << "\"";
+		Shell::filePutContents(cmdFile, content);
+		compile = cmd;
+		compile << " @" << cmdFile;
+
+		// A restored object may be a link to a cache entry
+		Shell::remove(objFile);
+
+		// Modules write BMI files as a side effect, not cached
+		useCache = (!cachePath.isEmpty()) && moduleMapper.isEmpty();
+		if (!useCache) {
+			if (echoCmd) {
+				printf("%s %s\n", label.value(), compile.value());
+			};
+			begin = BuildTrace::now();
+			status = Process::system(compile, true);
+			BuildTrace::event("compile", sourceFile, begin, compile, status, objFile);
+			return (status == 0);
+		};
+
+		String preprocessedFile = objFile + ".ii";
+		String diagnosticFile = objFile + ".txt";
+		String preprocessCmdFile = objFile + "2ii";
+		String preprocess = cmd;
+		String keyFlags = reproduciblePath(CompileCache::normalizeFlags(flags));
+		if (keyFlags.indexOf(" -g", 0, index)) {
+			keyFlags << " " << reproduciblePath(FileSystem::getCurrentDirectory());
+		};
+
+		content = flags;
+		content << " -E -o \"" << preprocessedFile << "\"";
+		content << " \"" << sourceFile << "\"";
+		Shell::filePutContents(preprocessCmdFile, content);
+		preprocess << " @" << preprocessCmdFile << " 2> \"" << diagnosticFile << "\"";
+
+		// The cache lookup event ends with exit 0 on a hit
+		begin = BuildTrace::now();
+		key = "";
+		if (Process::system(preprocess, true) == 0) {
+			if (!CompileCache::makeKey(compilerIdentity, keyFlags, preprocessedFile, reproducibleRoot, key)) {
+				key = "";
+			};
+		};
+		Shell::remove(preprocessedFile);
+
+		if (!key.isEmpty()) {
+			if (!remoteCache.isEmpty()) {
+				RemoteCache::fetch(remoteCache, cachePath, key);
+			};
+			if (CompileCache::restore(cachePath, key, objFile)) {
+				BuildTrace::event("cache", sourceFile, begin, preprocess, 0, objFile);
+				if (echoCmd) {
+					printf("%s cache hit %s\n", label.value(), sourceFile.value());
+				};
+				Shell::remove(diagnosticFile);
+				// Memory of the preprocessor is not what a compile needs
+				Process::resetUsage();
+				return true;
+			};
+		};
+
+		BuildTrace::event("cache", sourceFile, begin, preprocess, 1, "");
+
+		if (echoCmd) {
+			printf("%s %s\n", label.value(), compile.value());
+		};
+		compile << " 2> \"" << diagnosticFile << "\"";
+		begin = BuildTrace::now();
+		status = Process::system(compile, true);
+		BuildTrace::event("compile", sourceFile, begin, compile, status, objFile);
+		retV = (status == 0);
+		CompileCache::printDiagnostic(diagnosticFile);
+		if (retV && !key.isEmpty()) {
+			if (CompileCache::store(cachePath, cacheSize, key, objFile, diagnosticFile)) {
+				if (!remoteCache.isEmpty()) {
+					RemoteCache::upload(remoteCache, cachePath, key);
+				};
+			};
+		};
+		Shell::remove(diagnosticFile);
+		return retV;
+	};
+
+	void CompilerGCC::linkLibraryFiles(
+	    TDynamicArray<String> &libDependencyPath,
+	    TDynamicArray<String> &libDependency,
+	    TDynamicArray<String> &libFiles) {
+		TDynamicArray<String> names;
+		size_t k;
+		size_t m;
+		size_t n;
+
+		// Same names the linker searches for, system libraries are not found
+		// in the library paths and are covered by the linker identity
+		for (k = 0; k < libDependency.length(); ++k) {
+			names.empty();
+			if (libDependency[k][0] == ':') {
+				String name = libDependency[k].substring(1);
+				if (libDependency[k].endsWith(".static") || isStatic) {
+					names.push(name + ".a");
+				} else if (isOSWindows) {
+					names.push(name + ".dll");
+				} else {
+					names.push(name + ".so");
+				};
+			} else {
+				String name = libDependency[k].replace("lib", "");
+				if (isOSWindows) {
+					names.push("lib" + name + ".dll.a");
+					names.push("lib" + name + ".a");
+					names.push(name + ".lib");
+					names.push("lib" + name + ".dll");
+					names.push(name + ".dll");
+				} else {
+					names.push("lib" + name + ".so");
+					names.push("lib" + name + ".a");
+				};
+			};
+			for (m = 0; m < libDependencyPath.length(); ++m) {
+				for (n = 0; n < names.length(); ++n) {
+					String fileName = libDependencyPath[m].replace("\\", "/") + "/" + names[n];
+					if (Shell::fileExists(fileName)) {
+						libFiles.push(fileName);
+						break;
+					};
+				};
+				if (n < names.length()) {
+					break;
+				};
+			};
+		};
+	};
+
+	String CompilerGCC::linkCacheKey(
+	    String identity,
+	    String cmdFile,
+	    TDynamicArray<String> &inputs) {
+		String content;
+		String key;
+
+		if (cachePath.isEmpty()) {
+			return "";
+		};
+		if (!Shell::fileGetContents(cmdFile, content)) {
+			return "";
+		};
+		if (!CompileCache::makeLinkKey(identity, content, inputs, reproducibleRoot, key)) {
+			return "";
+		};
+		return key;
+	};
+
+	bool CompilerGCC::linkCacheRestore(
+	    String key,
+	    String outFile,
+	    bool echoCmd) {
+		uint64_t begin = BuildTrace::now();
+		if (key.isEmpty()) {
+			return false;
+		};
+		if (!remoteCache.isEmpty()) {
+			RemoteCache::fetch(remoteCache, cachePath, key);
+		};
+		if (!CompileCache::restoreOutput(cachePath, key, outFile)) {
+			BuildTrace::event("cache", outFile, begin, "", 1, "");
+			return false;
+		};
+		BuildTrace::event("cache", outFile, begin, "", 0, outFile);
+		if (echoCmd) {
+			printf("cache hit %s\n", outFile.value());
+		};
+		return true;
+	};
+
+	void CompilerGCC::linkCacheStore(
+	    String key,
+	    String outFile) {
+		if (key.isEmpty()) {
+			return;
+		};
+		if (CompileCache::store(cachePath, cacheSize, key, outFile, "")) {
+			if (!remoteCache.isEmpty()) {
+				RemoteCache::upload(remoteCache, cachePath, key);
+			};
+		};
+	};
+
+	bool CompilerGCC::makeObjToLib(
+	    String libName,
+	    String binPath,
+	    String libPath,
+	    String tmpPath,
+	    int options,
+	    TDynamicArray<String> &objFiles,
+	    String defFile,
+	    TDynamicArray<String> &libDependencyPath,
+	    TDynamicArray<String> &libDependency,
+	    String version,
+	    bool echoCmd,
+	    bool force) {
+		options = filterOptions(options);
+
+		String cmd;
+		int k;
+		String content;
+		String libNameOut;
+
+		if (objFiles.isEmpty()) {
+			return false;
+		};
+
+		if (!Shell::mkdirRecursivelyIfNotExists(binPath)) {
+			return false;
+		};
+		if (!Shell::mkdirRecursivelyIfNotExists(libPath)) {
+			return false;
+		};
+		if (!Shell::mkdirRecursivelyIfNotExists(tmpPath)) {
+			return false;
+		};
+
+		binPath = binPath.replace("\\", "/");
+		libPath = libPath.replace("\\", "/");
+		tmpPath = tmpPath.replace("\\", "/");
+
+		if (options & CompilerOptions::StaticLibrary) {
+			libNameOut = libPath + "/" + libName + ".a";
+			if (!force) {
+				if (!Shell::isChanged(libNameOut, objFiles)) {
+					return true;
+				};
+			};
+			String key;
+			if (!cachePath.isEmpty()) {
+				TDynamicArray<String> linkInputs;
+				content = arCommand() + " \"" + libNameOut + "\"";
+				for (k = 0; k < objFiles.length(); ++k) {
+					content << " \"" << objFiles[k].replace("\\", "/") << "\"";
+					linkInputs.push(objFiles[k]);
+				};
+				Shell::filePutContents(tmpPath + "/" + libName + ".o2a", content);
+				key = linkCacheKey(CompileCache::toolIdentity(lto ? "gcc-ar" : "ar", tmpPath), tmpPath + "/" + libName + ".o2a", linkInputs);
+				if (linkCacheRestore(key, libNameOut, echoCmd)) {
+					return true;
+				};
+			};
+			Shell::remove(libNameOut);
+			for (k = 0; k < objFiles.length(); ++k) {
+				cmd = arCommand();
+				cmd << " \"" << libNameOut << "\"";
+				cmd << " \"" << objFiles[k].replace("\\", "/") << "\"";
+				if (echoCmd) {
+					printf("[%d/%d] %s\n", (int)(k + 1), (int)objFiles.length(), cmd.value());
+				};
+				if (runCommand("archive", objFiles[k], cmd, libNameOut) != 0) {
+					Shell::remove(libNameOut);
+					return false;
+				};
+			};
+			linkCacheStore(key, libNameOut);
+			return true;
+		};
+
+		if (options & CompilerOptions::DynamicLibrary) {
+			if (isOSLinux) {
+				libNameOut = binPath << "/" << libName << ".so";
+				if (!version.isEmpty()) {
+					libNameOut << "." << version;
+				};
+			};
+			if (isOSWindows) {
+				libNameOut = binPath << "/" << libName;
+				if (!version.isEmpty()) {
+					libNameOut << "-" << version;
+				};
+				libNameOut << ".dll";
+			};
+			// Only the baseline is linked against
+			String libCopy;
+			if (!(options & CompilerOptions::ISALevel)) {
+				if (isOSLinux) {
+					libCopy = libPath + "/" + libName + ".so";
+				};
+				if (isOSWindows) {
+					libCopy = libPath + "/" + libName + ".dll";
+				};
+			};
+			// The copy is made once debug info is split
+			bool splitLibrary = splitDebug && (!isOSEmscripten);
+			if (splitLibrary) {
+				splitDebugFiles.push(libNameOut);
+				splitDebugCopies.push(libCopy);
+			};
+
+			content << "-shared -o \"" << libNameOut << "\" -Wl,-rpath='$ORIGIN";
+			if (options & CompilerOptions::ISALevel) {
+				content << ":$ORIGIN/../..";
+			};
+			content << "'";
+			if (!version.isEmpty()) {
+				if (isOSLinux) {
+					content << ",-soname," << libName << ".so." << version;
+				};
+				if (isOSWindows) {
+					content << ",-soname," << libName << "-" << version << ".dll";
+				};
+			};
+			if (!linker.isEmpty()) {
+				content << " -fuse-ld=" << linker;
+			};
+			if (isOSWindows && (!reproducibleRoot.isEmpty())) {
+				content << " -Wl,--no-insert-timestamp";
+			};
+			content << ltoLinkFlags();
+			if (!symbolOrderingFile.isEmpty()) {
+				if (linker.isEmpty()) {
+					content << " -fuse-ld=lld";
+				};
+				content << " -Wl,--symbol-ordering-file=\"" << symbolOrderingFile.replace("\\", "/") << "\"";
+				content << " -Wl,--no-warn-symbol-ordering";
+			};
+			for (k = 0; k < objFiles.length(); ++k) {
+				content << " \"" << objFiles[k].replace("\\", "/") << "\"";
+			};
+			for (k = 0; k < libDependencyPath.length(); ++k) {
+				if (isOSLinux) {
+					content << " -L\"" << libDependencyPath[k] << "\"";
+				};
+				if (isOSWindows) {
+					content << " -L\"" << libDependencyPath[k].replace("\\", "/") << "\"";
+				};
+			};
+			for (k = 0; k < libDependency.length(); ++k) {
+				if (libDependency[k][0] == ':') {
+					if (libDependency[k].endsWith(".static")) {
+						content << " -l" << libDependency[k] << ".a";
+						continue;
+					};
+					if (isOSLinux) {
+						if (isStatic) {
+							content << " -l" << libDependency[k] << ".a";
+						} else {
+							content << " -l" << libDependency[k] << ".so";
+						};
+					};
+					if (isOSWindows) {
+						if (isStatic) {
+							content << " -l" << libDependency[k] << ".a";
+						} else {
+							content << " -l" << libDependency[k] << ".dll";
+						}
+					};
+					continue;
+				};
+				content << " -l" << libDependency[k].replace("lib", "");
+			};
+			content << " -lstdc++";
+			content << " -lpthread";
+			content << " -lm";
+			if (isOSLinux) {
+				content << " -ldl";
+			};
+			if (isOSWindows) {
+				content << " -luser32 -lws2_32";
+			};
+
+			if (isOSEmscripten) {
+				content += " -s NODERAWFS=1 -pthread";
+			};
+
+			if (!force) {
+				TDynamicArray<String> linkInputs;
+				for (k = 0; k < objFiles.length(); ++k) {
+					linkInputs.push(objFiles[k]);
+				};
+				if (!symbolOrderingFile.isEmpty()) {
+					linkInputs.push(symbolOrderingFile);
+				};
+				if (!Shell::isChanged(libNameOut, linkInputs)) {
+					if (!isCmdFileChanged(tmpPath + "/" + libName + ".o2so", content)) {
+						return true;
+					};
+				};
+			};
+
+			Shell::filePutContents(tmpPath + "/" + libName + ".o2so", content);
+			cmd = cxxCommand() + " @";
+			cmd << tmpPath + "/" + libName + ".o2so";
+
+			String key;
+			if (!cachePath.isEmpty()) {
+				TDynamicArray<String> linkInputs;
+				for (k = 0; k < objFiles.length(); ++k) {
+					linkInputs.push(objFiles[k]);
+				};
+				if (!symbolOrderingFile.isEmpty()) {
+					linkInputs.push(symbolOrderingFile);
+				};
+				linkLibraryFiles(libDependencyPath, libDependency, linkInputs);
+				key = linkCacheKey(CompileCache::linkerIdentity(cxxCommand(), linkerName(), tmpPath), tmpPath + "/" + libName + ".o2so", linkInputs);
+			};
+			bool linked = linkCacheRestore(key, libNameOut, echoCmd);
+			if (!linked) {
+				if (echoCmd) {
+					printf("%s\n", cmd.value());
+				};
+				linked = (runCommand("link", libNameOut, cmd, libNameOut) == 0);
+				if (linked) {
+					linkCacheStore(key, libNameOut);
+				};
+			};
+			if (linked) {
+				if (splitLibrary || libCopy.isEmpty()) {
+					return true;
+				};
+				return Shell::copy(libNameOut, libCopy);
+			};
+			Shell::remove(tmpPath + "/" + libName + ".o2so");
+			return false;
+		};
+
+		if (echoCmd) {
+			printf("%s\n", cmd.value());
+		};
+		if (runCommand("link", libNameOut, cmd, libNameOut) == 0) {
+			return true;
+		};
+		return false;
+	};
+
+	bool CompilerGCC::makeObjToExe(
+	    String exeName,
+	    String binPath,
+	    String tmpPath,
+	    int options,
+	    TDynamicArray<String> &objFiles,
+	    TDynamicArray<String> &libDependencyPath,
+	    TDynamicArray<String> &libDependency,
+	    bool echoCmd,
+	    bool force) {
+		if (isOSWindows) {
+			options = filterOptions(options);
+		};
+
+		String cmd;
+		int k;
+		String content;
+		String exeNameOut;
+
+		if (objFiles.isEmpty()) {
+			return false;
+		};
+
+		if (!Shell::mkdirRecursivelyIfNotExists(binPath)) {
+			return false;
+		};
+		if (!Shell::mkdirRecursivelyIfNotExists(tmpPath)) {
+			return false;
+		};
+
+		binPath = binPath.replace("\\", "/");
+		tmpPath = tmpPath.replace("\\", "/");
+
+		exeNameOut = binPath << "/" << exeName;
+		if (isOSWindows) {
+			if (!exeNameOut.endsWith(".exe")) {
+				exeNameOut << ".exe";
+			};
+		};
+		if (splitDebug) {
+			if (!isOSEmscripten) {
+				splitDebugFiles.push(exeNameOut);
+				splitDebugCopies.push("");
+			};
+		};
+
+		if (isOSEmscripten) {
+			content += " -s NODERAWFS=1 -pthread ";
+			String exePreRUN = tmpPath + "/" + exeName + ".prerun.js";
+			String exePreRUNContent = "";
+			exePreRUNContent+="Module[\"preRun\"] = () => {\r\n";
+			exePreRUNContent+="\tif (ENVIRONMENT_IS_NODE) {\r\n";
+			exePreRUNContent+="\t\tif (typeof(ENV) !== 'undefined') {\r\n";
+			exePreRUNContent<<"\t\t\tENV['EMSCRIPTEN_PLATFORM'] = process.platform;\r\n";
+			exePreRUNContent<<"\t\t\tENV['TEMP'] = process.env.TEMP;\r\n";
+			// ---
+			String exeEnv = tmpPath + "/" + exeName + ".env";
+			if(Shell::fileExists(exeEnv)) {
+				String exeEnvContent;
+				if(Shell::fileGetContentsUTF8(exeEnv,exeEnvContent,UTFStreamMode::UTF8)) {
+					TDynamicArray<String> exeEnvList;
+					if(exeEnvContent.explode("\r", exeEnvList)) {
+						String line;
+						size_t k;																		
+						for(k=0;k<exeEnvList.length();++k) {
+							line=exeEnvList[k].trimASCII();
+							if(line.length()==0) {
+								continue;
+							};
+							if(line[0]=='#') {
+								continue;
+							};
+							exePreRUNContent<<"\t\t\tENV['"<<line<<"'] = process.env."<<line<<";\r\n";
+						};
+					};
+				};
+			};									
+			// ---
+			exePreRUNContent+="\t\t}\r\n";
+			exePreRUNContent+="\t}\r\n";
+			exePreRUNContent+="}\r\n";
+			Shell::filePutContentsUTF8(exePreRUN,exePreRUNContent,UTFStreamMode::UTF8);
+			content << " --pre-js \"" << exePreRUN << "\" ";					
+		};
+
+		content << "-o \"" << exeNameOut << "\" -Wl,-rpath='$ORIGIN'";
+		if (!linker.isEmpty()) {
+			content << " -fuse-ld=" << linker;
+		};
+		if (isOSWindows && (!reproducibleRoot.isEmpty())) {
+			content << " -Wl,--no-insert-timestamp";
+		};
+		content << ltoLinkFlags();
+		if (!symbolOrderingFile.isEmpty()) {
+			if (linker.isEmpty()) {
+				content << " -fuse-ld=lld";
+			};
+			content << " -Wl,--symbol-ordering-file=\"" << symbolOrderingFile.replace("\\", "/") << "\"";
+			content << " -Wl,--no-warn-symbol-ordering";
+		};
+		if (hugePageText) {
+			if (isOSLinux && (!isOSEmscripten)) {
+				content << " -Wl,-z,common-page-size=2097152 -Wl,-z,max-page-size=2097152";
+				if ((linker == "lld") || (linker.isEmpty() && (!symbolOrderingFile.isEmpty()))) {
+					content << " -Wl,-z,separate-loadable-segments";
+				} else {
+					content << " -Wl,-z,separate-code";
+				};
+			};
+		};
+		for (k = 0; k < objFiles.length(); ++k) {
+			content << " \"" << objFiles[k].replace("\\", "/") << "\"";
+		};
+		for (k = 0; k < libDependencyPath.length(); ++k) {
+			if (isOSLinux) {
+				content << " -L\"" << libDependencyPath[k] << "\"";
+			};
+			if (isOSWindows) {
+				content << " -L\"" << libDependencyPath[k].replace("\\", "/") << "\"";
+			};
+		};
+		for (k = 0; k < libDependency.length(); ++k) {
+			if (libDependency[k][0] == ':') {
+				if (libDependency[k].endsWith(".static")) {
+					content << " -l" << libDependency[k] << ".a";
+					continue;
+				};
+				if (isOSLinux) {
+					if (isStatic) {
+						content << " -l" << libDependency[k] << ".a";
+					} else {
+						content << " -l" << libDependency[k] << ".so";
+					};
+				};
+				if (isOSWindows) {
+					if (isStatic) {
+						content << " -l" << libDependency[k] << ".a";
+					} else {
+						content << " -l" << libDependency[k] << ".dll";
+					}
+				};
+				continue;
+			};
+			content << " -l" << libDependency[k].replace("lib", "");
+		};
+
+		if (isOSWindows) {
+			if (options & CompilerOptions::CRTStatic) {
+				content << " -static-libstdc++ -static-libgcc";
+				content << " -Wl,-Bstatic -lstdc++ -lpthread -lm -Wl,-Bdynamic";
+			} else {
+				content << " -lstdc++";
+				content << " -lpthread";
+				content << " -lm";
+			};
+			content << " -luser32 -lws2_32";
+		};
+		if (isOSLinux) {
+			content << " -lstdc++";
+			content << " -lpthread";
+			content << " -lm";
+			content << " -ldl";
+		};
+		// Up to date if no input is newer and the link flags are the same,
+		// as for --hugepage-text turned on or off
+		if (!force) {
+			TDynamicArray<String> linkInputs;
+			for (k = 0; k < objFiles.length(); ++k) {
+				linkInputs.push(objFiles[k]);
+			};
+			if (!symbolOrderingFile.isEmpty()) {
+				linkInputs.push(symbolOrderingFile);
+			};
+			if (!Shell::isChanged(exeNameOut, linkInputs)) {
+				if (!isCmdFileChanged(tmpPath + "/" + exeName + ".o2elf", content)) {
+					return true;
+				};
+			};
+		};
+
+		Shell::filePutContents(tmpPath + "/" + exeName + ".o2elf", content);
+		cmd = cxxCommand() + " @";
+		cmd << tmpPath + "/" + exeName + ".o2elf";
+
+		String key;
+		if (!cachePath.isEmpty()) {
+			TDynamicArray<String> linkInputs;
+			for (k = 0; k < objFiles.length(); ++k) {
+				linkInputs.push(objFiles[k]);
+			};
+			if (!symbolOrderingFile.isEmpty()) {
+				linkInputs.push(symbolOrderingFile);
+			};
+			if (isOSEmscripten) {
+				linkInputs.push(tmpPath + "/" + exeName + ".prerun.js");
+			};
+			linkLibraryFiles(libDependencyPath, libDependency, linkInputs);
+			key = linkCacheKey(CompileCache::linkerIdentity(cxxCommand(), linkerName(), tmpPath), tmpPath + "/" + exeName + ".o2elf", linkInputs);
+			if (linkCacheRestore(key, exeNameOut, echoCmd)) {
+				return true;
+			};
+		};
+
+		if (echoCmd) {
+			printf("%s\n", cmd.value());
+		};
+		if (runCommand("link", exeNameOut, cmd, exeNameOut) == 0) {
+			linkCacheStore(key, exeNameOut);
+			return true;
+		};
+		// Not up to date on the next run with the same flags
+		Shell::remove(tmpPath + "/" + exeName + ".o2elf");
+		return false;
+	};
+
+	bool CompilerGCC::rcToRes(
+	    String rcFile,
+	    String resFile,
+	    TDynamicArray<String> &rcDefine,
+	    TDynamicArray<String> &incPath,
+	    bool echoCmd) {
+		if (isOSLinux) {
+			return false;
+		};
+		if (isOSWindows) {
+			String cmd;
+			int k;
+			if (!Shell::mkdirFilePath(resFile)) {
+				return false;
+			};
+
+			rcFile = rcFile.replace("\\", "/");
+			resFile = resFile.replace("\\", "/");
+			cmd = "windres ";
+			for (k = 0; k < incPath.length(); ++k) {
+				cmd << " -I \"" << incPath[k].replace("/", "\\") << "\"";
+			};
+			for (k = 0; k < rcDefine.length(); ++k) {
+				cmd << " --define \"" << rcDefine[k] << "\"";
+			};
+			cmd << " -l 409 -J rc -O res";
+			cmd << " -o \"" << resFile << "\"";
+			cmd << " -i \"" << rcFile << "\"";
+
+			if (echoCmd) {
+				printf("%s\n", cmd.value());
+			};
+			return (runCommand("resource", rcFile, cmd, resFile) == 0);
+		};
+		return false;
+	};
+
+	bool CompilerGCC::resToObj(
+	    String resFile,
+	    String objFile,
+	    bool echoCmd) {
+		if (isOSLinux) {
+			return false;
+		};
+		if (isOSWindows) {
+			String cmd;
+			if (!Shell::mkdirFilePath(objFile)) {
+				return false;
+			};
+
+			resFile = resFile.replace("/", "\\");
+			objFile = objFile.replace("/", "\\");
+
+			cmd = "windres -J res -O coff";
+
+			cmd << " -o \"" << objFile << "\" -i \"" << resFile << "\"";
+
+			if (echoCmd) {
+				printf("%s\n", cmd.value());
+			};
+			return (runCommand("resource", resFile, cmd, objFile) == 0);
+		};
+
+		return false;
+	};
+
+	bool CompilerGCC::makeRcToObj(
+	    String rcFile,
+	    String objFile,
+	    TDynamicArray<String> &rcDefine,
+	    TDynamicArray<String> &incPath,
+	    bool echoCmd,
+	    bool force) {
+		if (isOSLinux) {
+			return false;
+		};
+		if (isOSWindows) {
+			bool toMake;
+
+			String resFile = objFile.replace(".o", ".res");
+			toMake = false;
+			if (!Shell::fileExists(resFile)) {
+				toMake = true;
+			} else {
+				if (Shell::compareLastWriteTime(resFile, rcFile) < 0) {
+					toMake = true;
+				};
+			};
+
+			if (toMake || force) {
+				if (!rcToRes(rcFile, resFile, rcDefine, incPath, echoCmd)) {
+					return false;
+				};
+			};
+
+			toMake = false;
+			if (!Shell::fileExists(objFile)) {
+				toMake = true;
+			} else {
+				if (Shell::compareLastWriteTime(objFile, resFile) < 0) {
+					toMake = true;
+				};
+			};
+
+			if (toMake || force) {
+				if (!resToObj(resFile, objFile, echoCmd)) {
+					return false;
+				};
+			};
+
+			return true;
+		};
+
+		return false;
+	}
+
+	namespace CompilerGCCWorker {
+
+		class CompilerWorkerBool : public Object {
+			public:
+				bool value;
+				// milliseconds of the job
+				uint64_t duration;
+				// the job ran a compiler, not restored from the cache
+				bool compiled;
+				// bytes, 0 if the job did not run a compiler
+				uint64_t peakMemory;
+				// not run or terminated after another job failed
+				bool cancelled;
+				// killed by a signal, the oom killer or the timeout
+				int signal;
+				bool oomKilled;
+				bool timedOut;
+
+				inline CompilerWorkerBool() {
+					value = false;
+					duration = 0;
+					compiled = false;
+					peakMemory = 0;
+					cancelled = false;
+					signal = 0;
+					oomKilled = false;
+					timedOut = false;
+				};
+
+				inline bool isKilled() {
+					return (signal != 0) || oomKilled || timedOut;
+				};
+		};
+
+		TPointer<CompilerWorkerBool> compilerTransferWorkerBool(CompilerWorkerBool &value) {
+			TPointer<CompilerWorkerBool> retV;
+			retV.newMemory();
+			retV->value = value.value;
+			retV->duration = value.duration;
+			retV->compiled = value.compiled;
+			retV->peakMemory = value.peakMemory;
+			retV->cancelled = value.cancelled;
+			retV->signal = value.signal;
+			retV->oomKilled = value.oomKilled;
+			retV->timedOut = value.timedOut;
+			return retV;
+		};
+
+		class CompilerWorkerCppToObj : public Object {
+			public:
+				String cppFile;
+				String objFile;
+				int options;
+				TDynamicArray<String> incPath;
+				TDynamicArray<String> cppDefine;
+				int index;
+				int indexLn;
+				bool echoCmd;
+				// expected bytes, reserved from the memory budget
+				uint64_t peakMemory;
+				CompilerGCC *super;
+
+				inline CompilerWorkerCppToObj() {
+					peakMemory = 0;
+				};
+		};
+
+		TPointer<CompilerWorkerCppToObj> compilerTransferWorkerCppToObj(CompilerWorkerCppToObj &value) {
+			TPointer<CompilerWorkerCppToObj> retV;
+			retV.newMemory();
+			retV->cppFile = value.cppFile.value();
+			retV->objFile = value.objFile.value();
+			retV->options = value.options;
+			size_t k;
+			TDynamicArray<String> *source;
+			TDynamicArray<String> *target;
+
+			source = &value.incPath;
+			target = &retV->incPath;
+			for (k = 0; k < source->length(); ++k) {
+				(target->index(k)) = (source->index(k)).value();
+			};
+
+			source = &value.cppDefine;
+			target = &retV->cppDefine;
+			for (k = 0; k < source->length(); ++k) {
+				(target->index(k)) = (source->index(k)).value();
+			};
+
+			retV->index = value.index;
+			retV->indexLn = value.indexLn;
+			retV->echoCmd = value.echoCmd;
+			retV->peakMemory = value.peakMemory;
+			retV->super = value.super;
+			return retV;
+		};
+
+		static bool isJobCancelled(CompilerWorkerBool *retV, TAtomic<bool> &requestToTerminate) {
+			if (Process::isStopped() || requestToTerminate.get()) {
+				retV->cancelled = true;
+				return true;
+			};
+			return false;
+		};
+
+		static void jobDone(CompilerWorkerBool *retV, CompilerGCC *super) {
+			if (retV->value) {
+				return;
+			};
+			if (Process::isStopped()) {
+				retV->cancelled = true;
+				return;
+			};
+			// Retried with fewer jobs, not a compile error
+			if (retV->isKilled()) {
+				return;
+			};
+			if (!super->keepGoing) {
+				Process::stop(super->failFast);
+			};
+		};
+
+		TPointer<CompilerWorkerBool> compilerWorkerProcedureCppToObj(CompilerWorkerCppToObj *parameter, TAtomic<bool> &requestToTerminate) {
+			TPointer<CompilerWorkerBool> retV;
+			retV.newMemory();
+			if (parameter) {
+				Process::Usage usage;
+				if (isJobCancelled(retV, requestToTerminate)) {
+					return retV;
+				};
+				MemoryBudget::admit(parameter->peakMemory);
+				LoadLimit::admit();
+				int token = JobServer::acquire();
+				uint64_t start = FileSystem::getMilliseconds();
+				Process::resetUsage();
+				retV->value = parameter->super->cppToObj(
+				    parameter->options,
+				    parameter->cppFile,
+				    parameter->objFile,
+				    parameter->cppDefine,
+				    parameter->incPath,
+				    parameter->index,
+				    parameter->indexLn,
+				    parameter->echoCmd);
+				retV->duration = FileSystem::getMilliseconds() - start;
+				Process::getUsage(usage);
+				if (usage.processes > 0) {
+					retV->compiled = true;
+					retV->peakMemory = usage.peakMemory;
+				};
+				retV->signal = usage.signal;
+				retV->oomKilled = usage.oomKilled;
+				retV->timedOut = usage.timedOut;
+				JobServer::release(token);
+				LoadLimit::release();
+				MemoryBudget::release(parameter->peakMemory);
+				jobDone(retV, parameter->super);
+			};
+			return retV;
+		};
+
+		TPointer<CompilerWorkerBool> compilerWorkerProcedureCToObj(CompilerWorkerCppToObj *parameter, TAtomic<bool> &requestToTerminate) {
+			TPointer<CompilerWorkerBool> retV;
+			retV.newMemory();
+			if (parameter) {
+				Process::Usage usage;
+				if (isJobCancelled(retV, requestToTerminate)) {
+					return retV;
+				};
+				MemoryBudget::admit(parameter->peakMemory);
+				LoadLimit::admit();
+				int token = JobServer::acquire();
+				uint64_t start = FileSystem::getMilliseconds();
+				Process::resetUsage();
+				retV->value = parameter->super->cToObj(
+				    parameter->cppFile,
+				    parameter->objFile,
+				    parameter->options,
+				    parameter->cppDefine,
+				    parameter->incPath,
+				    parameter->index,
+				    parameter->indexLn,
+				    parameter->echoCmd);
+				retV->duration = FileSystem::getMilliseconds() - start;
+				Process::getUsage(usage);
+				if (usage.processes > 0) {
+					retV->compiled = true;
+					retV->peakMemory = usage.peakMemory;
+				};
+				retV->signal = usage.signal;
+				retV->oomKilled = usage.oomKilled;
+				retV->timedOut = usage.timedOut;
+				JobServer::release(token);
+				LoadLimit::release();
+				MemoryBudget::release(parameter->peakMemory);
+				jobDone(retV, parameter->super);
+			};
+			return retV;
+		};
+
+		// Rounds of retries of a killed compile job, a job that timed out
+		// with fewer threads running is likely to time out again
+		static const int maxRetries = 2;
+		static const int maxTimeoutRetries = 1;
+
+		static void addCompileJob(
+		    WorkerQueue &queue,
+		    CompilerGCC *super,
+		    bool isCSource,
+		    int options,
+		    TDynamicArray<String> &define,
+		    TDynamicArray<String> &incPath,
+		    TDynamicArray<String> &srcFiles,
+		    TDynamicArray<String> &objFiles,
+		    size_t k,
+		    uint64_t peakMemory,
+		    bool echoCmd) {
+			TPointer<CompilerWorkerCppToObj> parameter;
+			size_t m;
+
+			parameter.newMemory();
+			parameter->super = super;
+			parameter->cppFile = srcFiles[k];
+			parameter->objFile = objFiles[k];
+			parameter->options = options;
+			for (m = 0; m < incPath.length(); ++m) {
+				parameter->incPath[m] = incPath[m];
+			};
+			for (m = 0; m < define.length(); ++m) {
+				parameter->cppDefine[m] = define[m];
+			};
+			parameter->index = (k + 1);
+			parameter->indexLn = srcFiles.length();
+			parameter->echoCmd = echoCmd;
+			parameter->peakMemory = peakMemory;
+			if (isCSource) {
+				TWorkerQueue<CompilerWorkerBool,
+				             CompilerWorkerCppToObj,
+				             compilerTransferWorkerBool,
+				             compilerTransferWorkerCppToObj,
+				             compilerWorkerProcedureCToObj>::add(queue, parameter);
+				return;
+			};
+			TWorkerQueue<CompilerWorkerBool,
+			             CompilerWorkerCppToObj,
+			             compilerTransferWorkerBool,
+			             compilerTransferWorkerCppToObj,
+			             compilerWorkerProcedureCppToObj>::add(queue, parameter);
+		};
+
+		TPointer<CompilerWorkerBool> compilerWorkerProcedureScanModule(CompilerWorkerCppToObj *parameter, TAtomic<bool> &requestToTerminate) {
+			TPointer<CompilerWorkerBool> retV;
+			retV.newMemory();
+			if (parameter) {
+				int token = JobServer::acquire();
+				retV->value = parameter->super->scanModuleDependency(
+				    parameter->options,
+				    parameter->cppFile,
+				    parameter->objFile,
+				    parameter->cppDefine,
+				    parameter->incPath,
+				    parameter->index,
+				    parameter->indexLn,
+				    parameter->echoCmd);
+				JobServer::release(token);
+			};
+			return retV;
+		};
+
+		bool processQueue(WorkerQueue &queue) {
+			size_t k;
+			TPointer<CompilerWorkerBool> retV;
+			if (queue.isEmpty()) {
+				return true;
+			};
+			if (!queue.process()) {
+				return false;
+			};
+			for (k = 0; k < queue.length(); ++k) {
+				retV = TStaticCast<CompilerWorkerBool *>(queue.getReturnValue(k));
+				if (retV) {
+					if (!retV->value) {
+						return false;
+					};
+					continue;
+				};
+				return false;
+			};
+			return true;
+		};
+
+	};
+
+	bool CompilerGCC::makePrecompiledHeader(
+	    String projectName,
+	    String tmpPath,
+	    int options,
+	    TDynamicArray<String> &cppDefine,
+	    TDynamicArray<String> &incPath,
+	    bool echoCmd,
+	    bool force) {
+		String cmd;
+		String content;
+		String flags;
+		String pchPath;
+		String pchHeader;
+		String pchFile;
+		String pchDepFile;
+		TDynamicArray<String> pchDependency;
+		bool toMake;
+
+		precompiledHeaderInclude = "";
+
+		tmpPath = tmpPath.replace("\\", "/");
+		flags = cppFlags(options, cppDefine, incPath);
+		cmd = cxxCommand();
+
+		pchPath = tmpPath + "/" + Shell::getFileName(projectName) + ".pch";
+		pchHeader = pchPath + "/" + (Digest::sha256(cmd + flags + precompiledHeader)).substring(0, 16) + ".hpp";
+		pchFile = pchHeader + ".gch";
+		pchDepFile = pchHeader + ".d";
+
+		toMake = force;
+		if (!Shell::fileExists(pchFile)) {
+			toMake = true;
+		} else {
+			if (!DepFile::read(pchDepFile, pchDependency)) {
+				toMake = true;
+			} else {
+				if (Shell::isChanged(pchFile, pchDependency)) {
+					toMake = true;
+				};
+			};
+		};
+
+		if (toMake) {
+			if (!Shell::mkdirRecursivelyIfNotExists(pchPath)) {
+				return false;
+			};
+			content = "#include <";
+			content << precompiledHeader << ">\n";
+			if (!Shell::filePutContents(pchHeader, content)) {
+				return false;
+			};
+
+			content = flags;
+			content << " -x c++-header -MD -MF \"" << pchDepFile << "\"";
+			content << " -o \"" << pchFile << "\"";
+			content << " \"" << pchHeader << "\"";
+
+			String cmdFile = pchHeader + "2gch";
+			Shell::filePutContents(cmdFile, content);
+			cmd << " @" << cmdFile;
+
+			if (echoCmd) {
+				printf("[pch] %s\n", cmd.value());
+			};
+			if (runCommand("pch", pchHeader, cmd, pchFile) != 0) {
+				Shell::remove(pchFile);
+				return false;
+			};
+		};
+
+		precompiledHeaderInclude = pchHeader;
+		return true;
+	};
+
+	bool CompilerGCC::makeSourcesToObj(
+	    bool isCSource,
+	    String projectName,
+	    String tmpPath,
+	    int options,
+	    TDynamicArray<String> &define,
+	    TDynamicArray<String> &incPath,
+	    TDynamicArray<String> &incFiles,
+	    TDynamicArray<String> &srcFiles,
+	    TDynamicArray<String> &objFiles,
+	    int numThreads,
+	    bool echoCmd,
+	    bool force) {
+		size_t k;
+		bool toMakeToObj;
+		bool usePrecompiledHeader;
+		FileTime pchTime;
+
+		TDynamicArray<FileTime> srcFilesTime;
+		TDynamicArray<FileTime> incFilesTime;
+		TDynamicArray<FileTime> objFilesTime;
+		TDynamicArray<size_t> jobSource;
+
+		if ((!isCSource) && modules && (!isOSEmscripten) && (srcFiles.length() > 0)) {
+			return makeModulesToObj(projectName, tmpPath, options, define, incPath, incFiles, srcFiles, objFiles, numThreads, echoCmd, force);
+		};
+
+		compilerIdentity = "";
+		if (!cachePath.isEmpty()) {
+			compilerIdentity = CompileCache::compilerIdentity(isCSource ? ccCommand() : cxxCommand(), tmpPath);
+		};
+
+		precompiledHeaderInclude = "";
+		usePrecompiledHeader = false;
+		if ((!isCSource) && (!precompiledHeader.isEmpty()) && (!isOSEmscripten) && (srcFiles.length() > 0)) {
+			if (!makePrecompiledHeader(projectName, tmpPath, options, define, incPath, echoCmd, force)) {
+				return false;
+			};
+			pchTime.getLastWriteTime(precompiledHeaderInclude + ".gch");
+			usePrecompiledHeader = true;
+		};
+
+		for (k = 0; k < incFiles.length(); ++k) {
+			incFilesTime[k].getLastWriteTime(incFiles[k]);
+		};
+
+		for (k = 0; k < srcFiles.length(); ++k) {
+			objFiles[k] = objFilename(projectName, srcFiles[k], tmpPath, options, (k + 1), srcFiles.length());
+			srcFilesTime[k].getLastWriteTime(srcFiles[k]);
+			objFilesTime[k].getLastWriteTime(objFiles[k]);
+		};
+
+		for (k = 0; k < srcFiles.length(); ++k) {
+			toMakeToObj = false;
+			if (srcFilesTime[k].isChanged(incFilesTime)) {
+				Shell::touchIfExists(srcFiles[k]);
+				toMakeToObj = true;
+			};
+			if (!Shell::fileExists(objFiles[k])) {
+				toMakeToObj = true;
+			} else {
+				if (objFilesTime[k].compare(srcFilesTime[k]) < 0) {
+					toMakeToObj = true;
+				};
+				if (usePrecompiledHeader) {
+					if (objFilesTime[k].compare(pchTime) < 0) {
+						toMakeToObj = true;
+					};
+				};
+				// Flags changed, as -ffunction-sections for symbol ordering
+				if (!toMakeToObj) {
+					if (isCompileChanged(isCSource, options, define, incPath, srcFiles[k], objFiles[k])) {
+						toMakeToObj = true;
+					};
+				};
+			};
+
+			if (!force) {
+				if (!toMakeToObj) {
+					continue;
+				};
+			};
+
+			jobSource.push(k);
+		};
+
+		return compileJobs(isCSource, projectName, tmpPath, options, define, incPath, srcFiles, objFiles, jobSource, numThreads, echoCmd);
+	};
+
+	bool CompilerGCC::compileJobs(
+	    bool isCSource,
+	    String projectName,
+	    String tmpPath,
+	    int options,
+	    TDynamicArray<String> &define,
+	    TDynamicArray<String> &incPath,
+	    TDynamicArray<String> &srcFiles,
+	    TDynamicArray<String> &objFiles,
+	    TDynamicArray<size_t> &jobSource,
+	    int numThreads,
+	    bool echoCmd) {
+		size_t k;
+		TPointer<CompilerGCCWorker::CompilerWorkerBool> retVToObj;
+		WorkerQueue compileToObj;
+		compileToObj.setNumberOfThreads(numThreads);
+
+		TDynamicArray<String> jobKeys;
+		TDynamicArray<String> jobFiles;
+		TDynamicArray<uint64_t> jobDurations;
+		TDynamicArray<uint64_t> jobPeakMemory;
+		TDynamicArray<size_t> jobOrder;
+		String historyFile = BuildHistory::fileName(tmpPath, projectName);
+		size_t known;
+		size_t knownPeakMemory;
+		uint64_t unknownPeakMemory;
+		size_t n;
+
+		for (n = 0; n < jobSource.length(); ++n) {
+			jobKeys.push(BuildHistory::jobKey(options, srcFiles[jobSource[n]]));
+			jobFiles.push(srcFiles[jobSource[n]]);
+		};
+
+		// Longest jobs first, the last job to start is a short one
+		BuildHistory::expectedDurations(historyFile, jobKeys, jobFiles, jobDurations, known);
+		BuildHistory::longestFirst(jobDurations, jobOrder);
+
+		// A job without history is expected to need as much as the largest
+		// known one, or an even share of the budget
+		BuildHistory::expectedPeakMemory(historyFile, jobKeys, jobPeakMemory, knownPeakMemory);
+		unknownPeakMemory = 0;
+		for (n = 0; n < jobPeakMemory.length(); ++n) {
+			if (jobPeakMemory[n] > unknownPeakMemory) {
+				unknownPeakMemory = jobPeakMemory[n];
+			};
+		};
+		if ((unknownPeakMemory == 0) && (numThreads > 0)) {
+			unknownPeakMemory = MemoryBudget::getBudget() / numThreads;
+		};
+		for (n = 0; n < jobPeakMemory.length(); ++n) {
+			if (jobPeakMemory[n] == 0) {
+				jobPeakMemory[n] = unknownPeakMemory;
+			};
+		};
+
+		for (n = 0; n < jobOrder.length(); ++n) {
+			CompilerGCCWorker::addCompileJob(compileToObj, this, isCSource, options, define, incPath, srcFiles, objFiles, jobSource[jobOrder[n]], jobPeakMemory[jobOrder[n]], echoCmd);
+		};
+
+		if (!compileToObj.isEmpty()) {
+			TDynamicArray<String> doneKeys;
+			TDynamicArray<String> failedFiles;
+			TDynamicArray<size_t> roundJobs;
+			TDynamicArray<size_t> retryJobs;
+			size_t cancelled = 0;
+			size_t retried = 0;
+			size_t recovered = 0;
+			TDynamicArray<uint64_t> doneDurations;
+			TDynamicArray<uint64_t> donePeakMemory;
+			bool retV = true;
+			int round;
+			int retries;
+			int roundThreads = numThreads;
+			WorkerQueue *queue = &compileToObj;
+			size_t delayed = MemoryBudget::getDelayed();
+			size_t delayedByLoad = LoadLimit::getDelayed();
+			Process::resume();
+			uint64_t start = FileSystem::getMilliseconds();
+			for (n = 0; n < jobOrder.length(); ++n) {
+				roundJobs.push(jobOrder[n]);
+			};
+			// Jobs killed by a signal, the oom killer or the timeout run
+			// again with half the threads, compile errors are not retried
+			for (round = 0;; ++round) {
+				WorkerQueue retryQueue;
+				if (round > 0) {
+					roundThreads = (roundThreads > 1) ? (roundThreads / 2) : 1;
+					retryQueue.setNumberOfThreads(roundThreads);
+					for (n = 0; n < roundJobs.length(); ++n) {
+						k = jobSource[roundJobs[n]];
+						CompilerGCCWorker::addCompileJob(retryQueue, this, isCSource, options, define, incPath, srcFiles, objFiles, k, jobPeakMemory[roundJobs[n]], echoCmd);
+					};
+					queue = &retryQueue;
+				};
+				if (!queue->process()) {
+					return false;
+				};
+				retryJobs.empty();
+				for (n = 0; n < queue->length(); ++n) {
+					k = jobSource[roundJobs[n]];
+					retVToObj = TStaticCast<CompilerGCCWorker::CompilerWorkerBool *>(queue->getReturnValue(n));
+					if (retVToObj) {
+						if (retVToObj->value) {
+							// A cache hit takes the preprocess time only,
+							// it is not what a compile of the source costs
+							if (retVToObj->compiled) {
+								doneKeys.push(jobKeys[roundJobs[n]]);
+								doneDurations.push(retVToObj->duration);
+								donePeakMemory.push(retVToObj->peakMemory);
+							};
+							if (round > 0) {
+								++recovered;
+							};
+							continue;
+						};
+					};
+					// A terminated compiler may leave a partial object
+					Shell::remove(objFiles[k]);
+					if (retVToObj) {
+						if (retVToObj->cancelled) {
+							++cancelled;
+							continue;
+						};
+						retries = retVToObj->timedOut ? CompilerGCCWorker::maxTimeoutRetries : CompilerGCCWorker::maxRetries;
+						if (retVToObj->isKilled() && (round < retries) && !Process::isStopped()) {
+							String reason;
+							char buffer[64];
+							if (retVToObj->timedOut) {
+								reason = "timed out";
+							} else if (retVToObj->oomKilled) {
+								reason = "killed by the oom killer";
+								// it needs at least the memory it had when killed
+								if (retVToObj->peakMemory > jobPeakMemory[roundJobs[n]]) {
+									jobPeakMemory[roundJobs[n]] = retVToObj->peakMemory;
+								};
+							} else {
+								snprintf(buffer, sizeof(buffer), "killed by signal %d", retVToObj->signal);
+								reason = buffer;
+							};
+							printf("[retry] %s %s, retry %d of %d with %d threads\n",
+							       srcFiles[k].value(),
+							       reason.value(),
+							       round + 1,
+							       retries,
+							       (roundThreads > 1) ? (roundThreads / 2) : 1);
+							retryJobs.push(roundJobs[n]);
+							++retried;
+							continue;
+						};
+					};
+					failedFiles.push(srcFiles[k]);
+					retV = false;
+				};
+				if (retryJobs.isEmpty()) {
+					break;
+				};
+				roundJobs.empty();
+				for (n = 0; n < retryJobs.length(); ++n) {
+					roundJobs.push(retryJobs[n]);
+				};
+			};
+			uint64_t actual = FileSystem::getMilliseconds() - start;
+			if (cancelled > 0) {
+				retV = false;
+			};
+			Process::resume();
+			if (failedFiles.length() > 0) {
+				printf("Error: %d of %d compile jobs failed\n", (int)failedFiles.length(), (int)jobOrder.length());
+				for (n = 0; n < failedFiles.length(); ++n) {
+					printf("    %s\n", failedFiles[n].value());
+				};
+				if (cancelled > 0) {
+					printf("    %d jobs %s after the first failure\n", (int)cancelled, failFast ? "terminated or not started" : "not started");
+				};
+			};
+			if (retried > 0) {
+				printf("[retry] %d retries, %d jobs recovered\n", (int)retried, (int)recovered);
+			};
+			BuildHistory::record(historyFile, doneKeys, doneDurations, donePeakMemory);
+			if (echoCmd && (jobOrder.length() > 1)) {
+				if (known > 0) {
+					printf("[schedule] %d jobs, %d with history, predicted %.1f s, actual %.1f s\n",
+					       (int)jobOrder.length(),
+					       (int)known,
+					       (double)BuildHistory::makespan(jobDurations, jobOrder, numThreads) / 1000.0,
+					       (double)actual / 1000.0);
+				} else {
+					printf("[schedule] %d jobs, by size, actual %.1f s\n",
+					       (int)jobOrder.length(),
+					       (double)actual / 1000.0);
+				};
+			};
+			if (echoCmd && MemoryBudget::isActive()) {
+				printf("[memory] budget %.0f MiB, %d jobs with peak memory history, %d waited for memory\n",
+				       (double)MemoryBudget::getBudget() / (1024.0 * 1024.0),
+				       (int)knownPeakMemory,
+				       (int)(MemoryBudget::getDelayed() - delayed));
+			};
+			if (echoCmd && LoadLimit::isActive()) {
+				printf("[load] %d jobs waited for load\n", (int)(LoadLimit::getDelayed() - delayedByLoad));
+			};
+			return retV;
+		};
+
+		return true;
+	};
+
+	bool CompilerGCC::scanModuleDependency(
+	    int options,
+	    String cppFile,
+	    String objFile,
+	    TDynamicArray<String> &cppDefine,
+	    TDynamicArray<String> &incPath,
+	    int index,
+	    int indexLn,
+	    bool echoCmd) {
+		String cmd;
+		String content;
+		String ddiFile = objFile + ".ddi";
+
+		if (!Shell::mkdirFilePath(objFile)) {
+			return false;
+		};
+
+		cmd = cxxCommand();
+		content = cppFlags(options, cppDefine, incPath);
+		content << " -fmodules-ts -E -x c++ \"" << cppFile << "\"";
+		content << " -MT \"" << ddiFile << "\" -MD -MF \"" << ddiFile << ".d\"";
+		content << " -fdeps-format=p1689r5 -fdeps-file=\"" << ddiFile << "\" -fdeps-target=\"" << objFile << "\"";
+		content << " -o \"" << ddiFile << ".i\"";
+
+		String cmdFile = objFile + "2ddi";
+		Shell::filePutContents(cmdFile, content);
+		cmd << " @" << cmdFile;
+
+		if (echoCmd) {
+			printf("[scan %s/%d] %s\n", (NumberX::leftPadByDigits(index, indexLn)).value(), indexLn, cmd.value());
+		};
+		if (runCommand("scan", cppFile, cmd, ddiFile) != 0) {
+			Shell::remove(ddiFile);
+			return false;
+		};
+		Shell::remove(ddiFile + ".i");
+		return true;
+	};
+
+	bool CompilerGCC::makeHeaderUnit(
+	    String headerFile,
+	    String cmiFile,
+	    int options,
+	    TDynamicArray<String> &cppDefine,
+	    TDynamicArray<String> &incPath,
+	    bool echoCmd,
+	    bool force) {
+		String cmd;
+		String content;
+		String depFile = cmiFile + ".d";
+		TDynamicArray<String> dependency;
+		bool toMake;
+
+		toMake = force;
+		if (!Shell::fileExists(cmiFile)) {
+			toMake = true;
+		} else {
+			if (!DepFile::read(depFile, dependency)) {
+				toMake = true;
+			} else {
+				if (Shell::isChanged(cmiFile, dependency)) {
+					toMake = true;
+				};
+			};
+		};
+		if (!toMake) {
+			return true;
+		};
+
+		if (!Shell::mkdirFilePath(cmiFile)) {
+			return false;
+		};
+
+		cmd = cxxCommand();
+		content = cppFlags(options, cppDefine, incPath);
+		content << " -fmodules-ts -fmodule-mapper=\"" << moduleMapper << "\" -fmodule-only";
+		content << " -MT \"" << cmiFile << "\" -MD -MF \"" << depFile << "\"";
+		content << " -x c++-header \"" << headerFile << "\"";
+
+		String cmdFile = cmiFile + "2hu";
+		Shell::filePutContents(cmdFile, content);
+		cmd << " @" << cmdFile;
+
+		if (echoCmd) {
+			printf("[header-unit] %s\n", cmd.value());
+		};
+		if (runCommand("header-unit", headerFile, cmd, cmiFile) != 0) {
+			Shell::remove(cmiFile);
+			return false;
+		};
+		return true;
+	};
+
+	bool CompilerGCC::makeModulesToObj(
+	    String projectName,
+	    String tmpPath,
+	    int options,
+	    TDynamicArray<String> &define,
+	    TDynamicArray<String> &incPath,
+	    TDynamicArray<String> &incFiles,
+	    TDynamicArray<String> &srcFiles,
+	    TDynamicArray<String> &objFiles,
+	    int numThreads,
+	    bool echoCmd,
+	    bool force) {
+		size_t k, m, n;
+		String modulePath;
+		String mapperFile;
+		String mapper;
+		String content;
+		TPointer<CompilerGCCWorker::CompilerWorkerCppToObj> parameter;
+		TDynamicArray<String> dependency;
+		TDynamicArray<String> provided;
+		TDynamicArray<String> required;
+		TDynamicArray<String> moduleName;
+		TDynamicArray<String> moduleFile;
+		TDynamicArray<size_t> moduleSource;
+		TDynamicArray<size_t> importModule;
+		TDynamicArray<size_t> importBy;
+		TDynamicArray<size_t> wave;
+		TDynamicArray<bool> toMake;
+		TDynamicArray<bool> incChanged;
+		TDynamicArray<size_t> jobSource;
+		TDynamicArray<FileTime> srcFilesTime;
+		TDynamicArray<FileTime> incFilesTime;
+		TDynamicArray<FileTime> objFilesTime;
+		TDynamicArray<FileTime> headerUnitTime;
+		size_t maxWave;
+		bool changed;
+
+		precompiledHeaderInclude = "";
+		moduleMapper = "";
+		if (!cachePath.isEmpty()) {
+			printf("Warning: compile cache not used with --modules, a compile writes module interface files\n");
+		};
+		tmpPath = tmpPath.replace("\\", "/");
+		modulePath = tmpPath + "/" + Shell::getFileName(projectName) + ".modules";
+		mapperFile = modulePath + "/mapper.txt";
+		if (!Shell::mkdirRecursivelyIfNotExists(modulePath)) {
+			return false;
+		};
+
+		for (k = 0; k < incFiles.length(); ++k) {
+			incFilesTime[k].getLastWriteTime(incFiles[k]);
+		};
+
+		for (k = 0; k < srcFiles.length(); ++k) {
+			objFiles[k] = objFilename(projectName, srcFiles[k], tmpPath, options, (k + 1), srcFiles.length());
+			srcFilesTime[k].getLastWriteTime(srcFiles[k]);
+			objFilesTime[k].getLastWriteTime(objFiles[k]);
+		};
+
+		// Scan module dependencies (P1689), only sources changed since last scan
+
+		WorkerQueue scanQueue;
+		scanQueue.setNumberOfThreads(numThreads);
+		for (k = 0; k < srcFiles.length(); ++k) {
+			String ddiFile = objFiles[k] + ".ddi";
+			bool toScan = force;
+			incChanged[k] = false;
+			if (srcFilesTime[k].isChanged(incFilesTime)) {
+				Shell::touchIfExists(srcFiles[k]);
+				incChanged[k] = true;
+				toScan = true;
+			};
+			if (!Shell::fileExists(ddiFile)) {
+				toScan = true;
+			} else {
+				if (!DepFile::read(ddiFile + ".d", dependency)) {
+					toScan = true;
+				} else {
+					if (Shell::isChanged(ddiFile, dependency)) {
+						toScan = true;
+					};
+				};
+			};
+			if (!toScan) {
+				continue;
+			};
+
+			parameter.newMemory();
+			parameter->super = this;
+			parameter->cppFile = srcFiles[k];
+			parameter->objFile = objFiles[k];
+			parameter->options = options;
+			for (m = 0; m < incPath.length(); ++m) {
+				parameter->incPath[m] = incPath[m];
+			};
+			for (m = 0; m < define.length(); ++m) {
+				parameter->cppDefine[m] = define[m];
+			};
+			parameter->index = (k + 1);
+			parameter->indexLn = srcFiles.length();
+			parameter->echoCmd = echoCmd;
+			TWorkerQueue<CompilerGCCWorker::CompilerWorkerBool,
+			             CompilerGCCWorker::CompilerWorkerCppToObj,
+			             CompilerGCCWorker::compilerTransferWorkerBool,
+			             CompilerGCCWorker::compilerTransferWorkerCppToObj,
+			             CompilerGCCWorker::compilerWorkerProcedureScanModule>::add(scanQueue, parameter);
+		};
+		if (!CompilerGCCWorker::processQueue(scanQueue)) {
+			return false;
+		};
+
+		// Modules provided and imported by each source
+
+		for (k = 0; k < srcFiles.length(); ++k) {
+			if (!ModuleDependency::read(objFiles[k] + ".ddi", provided, required)) {
+				printf("Error: module dependency of %s\n", srcFiles[k].value());
+				return false;
+			};
+			for (m = 0; m < provided.length(); ++m) {
+				for (n = 0; n < moduleName.length(); ++n) {
+					if (moduleName[n] == provided[m]) {
+						printf("Error: module %s provided by %s and %s\n", provided[m].value(), srcFiles[moduleSource[n]].value(), srcFiles[k].value());
+						return false;
+					};
+				};
+				moduleName.push(provided[m]);
+				moduleFile.push(modulePath + "/" + provided[m].replace(":", "-") + ".gcm");
+				moduleSource.push(k);
+			};
+		};
+		for (k = 0; k < srcFiles.length(); ++k) {
+			ModuleDependency::read(objFiles[k] + ".ddi", provided, required);
+			for (m = 0; m < required.length(); ++m) {
+				for (n = 0; n < moduleName.length(); ++n) {
+					if (moduleName[n] == required[m]) {
+						if (moduleSource[n] != k) {
+							importModule.push(n);
+							importBy.push(k);
+						};
+						break;
+					};
+				};
+			};
+		};
+
+		// Compile waves, a source comes after every source it imports from
+
+		for (k = 0; k < srcFiles.length(); ++k) {
+			wave[k] = 0;
+		};
+		maxWave = 0;
+		for (k = 0; k <= srcFiles.length(); ++k) {
+			changed = false;
+			for (m = 0; m < importBy.length(); ++m) {
+				n = wave[moduleSource[importModule[m]]] + 1;
+				if (wave[importBy[m]] < n) {
+					wave[importBy[m]] = n;
+					if (n > maxWave) {
+						maxWave = n;
+					};
+					changed = true;
+				};
+			};
+			if (!changed) {
+				break;
+			};
+		};
+		if (changed) {
+			printf("Error: module import cycle in %s\n", projectName.value());
+			return false;
+		};
+
+		// Module mapper, maps module and header unit names to BMI files
+
+		mapper = "";
+		for (k = 0; k < moduleName.length(); ++k) {
+			mapper << moduleName[k] << " " << moduleFile[k] << "\n";
+		};
+
+		TDynamicArray<String> headerUnitFile;
+		TDynamicArray<String> headerUnitCmi;
+		for (k = 0; k < headerUnits.length(); ++k) {
+			String headerFile;
+			for (m = 0; m < incPath.length(); ++m) {
+				headerFile = incPath[m].replace("\\", "/") + "/" + headerUnits[k];
+				if (Shell::fileExists(headerFile)) {
+					break;
+				};
+				headerFile = "";
+			};
+			if (headerFile.isEmpty()) {
+				printf("Error: header unit not found %s\n", headerUnits[k].value());
+				return false;
+			};
+			// Header unit names are paths, relative ones start with ./
+			if (!FileSystem::isAbsolutePath(headerFile)) {
+				if (!(headerFile.beginWith("./") || headerFile.beginWith("../"))) {
+					headerFile = String("./") + headerFile;
+				};
+			};
+			headerUnitFile.push(headerFile);
+			headerUnitCmi.push(modulePath + "/header-units/" + headerUnits[k] + ".gcm");
+			mapper << headerFile << " " << headerUnitCmi[k] << "\n";
+		};
+
+		if (!Shell::fileGetContents(mapperFile, content) || (content != mapper)) {
+			if (!Shell::filePutContents(mapperFile, mapper)) {
+				return false;
+			};
+		};
+		moduleMapper = mapperFile;
+
+		for (k = 0; k < headerUnitFile.length(); ++k) {
+			if (!makeHeaderUnit(headerUnitFile[k], headerUnitCmi[k], options, define, incPath, echoCmd, force)) {
+				moduleMapper = "";
+				return false;
+			};
+			headerUnitTime[k].getLastWriteTime(headerUnitCmi[k]);
+		};
+
+		for (k = 0; k < srcFiles.length(); ++k) {
+			toMake[k] = force || incChanged[k];
+			if (!Shell::fileExists(objFiles[k])) {
+				toMake[k] = true;
+				continue;
+			};
+			if (objFilesTime[k].compare(srcFilesTime[k]) < 0) {
+				toMake[k] = true;
+			};
+			for (m = 0; m < headerUnitTime.length(); ++m) {
+				if (objFilesTime[k].compare(headerUnitTime[m]) < 0) {
+					toMake[k] = true;
+				};
+			};
+			// Flags or module mapper changed, the object and its BMI
+			if (!toMake[k]) {
+				if (isCompileChanged(false, options, define, incPath, srcFiles[k], objFiles[k])) {
+					toMake[k] = true;
+				};
+			};
+		};
+		for (k = 0; k < moduleName.length(); ++k) {
+			if (!Shell::fileExists(moduleFile[k])) {
+				toMake[moduleSource[k]] = true;
+				continue;
+			};
+			if (Shell::compareLastWriteTime(moduleFile[k], srcFiles[moduleSource[k]]) < 0) {
+				toMake[moduleSource[k]] = true;
+			};
+		};
+
+		for (n = 0; n <= maxWave; ++n) {
+			// Importers are rebuilt when an imported interface is rebuilt or newer
+			for (m = 0; m < importBy.length(); ++m) {
+				k = importBy[m];
+				if (wave[k] != n) {
+					continue;
+				};
+				if (toMake[moduleSource[importModule[m]]]) {
+					toMake[k] = true;
+					continue;
+				};
+				if (Shell::compareLastWriteTime(objFiles[k], moduleFile[importModule[m]]) < 0) {
+					toMake[k] = true;
+				};
+			};
+
+			jobSource.empty();
+			for (k = 0; k < srcFiles.length(); ++k) {
+				if (wave[k] != n) {
+					continue;
+				};
+				if (!toMake[k]) {
+					continue;
+				};
+				jobSource.push(k);
+			};
+
+			if (!compileJobs(false, projectName, tmpPath, options, define, incPath, srcFiles, objFiles, jobSource, numThreads, echoCmd)) {
+				// Importers of a failed interface can not compile
+				m = 0;
+				for (k = 0; k < srcFiles.length(); ++k) {
+					if (wave[k] > n) {
+						++m;
+					};
+				};
+				if (m > 0) {
+					printf("Error: %d sources of later module waves skipped\n", (int)m);
+				};
+				moduleMapper = "";
+				return false;
+			};
+		};
+
+		moduleMapper = "";
+		return true;
+	};
+
+	bool CompilerGCC::splitDebugFile(
+	    String fileName,
+	    bool echoCmd) {
+		String cmd;
+		String objcopy;
+		String debugFile = fileName + ".debug";
+
+		if (Shell::fileExists(debugFile)) {
+			if (Shell::compareLastWriteTime(debugFile, fileName) >= 0) {
+				return true;
+			};
+		};
+
+		objcopy = Shell::getEnv("OBJCOPY");
+		if (objcopy.length() == 0) {
+			objcopy = "objcopy";
+		};
+
+		cmd = objcopy;
+		cmd << " --only-keep-debug \"" << fileName << "\" \"" << debugFile << "\"";
+		if (echoCmd) {
+			printf("%s\n", cmd.value());
+		};
+		if (runCommand("debug", fileName, cmd, debugFile) != 0) {
+			Shell::remove(debugFile);
+			return false;
+		};
+
+		cmd = objcopy;
+		cmd << " --strip-unneeded --add-gnu-debuglink=\"" << debugFile << "\" \"" << fileName << "\"";
+		if (echoCmd) {
+			printf("%s\n", cmd.value());
+		};
+		if (runCommand("debug", fileName, cmd, fileName) != 0) {
+			Shell::remove(debugFile);
+			return false;
+		};
+
+		return Shell::touchIfExists(debugFile);
+	};
+
+	namespace CompilerGCCWorker {
+
+		class CompilerWorkerSplitDebug : public Object {
+			public:
+				String fileName;
+				String copyFile;
+				bool echoCmd;
+				CompilerGCC *super;
+		};
+
+		TPointer<CompilerWorkerSplitDebug> compilerTransferWorkerSplitDebug(CompilerWorkerSplitDebug &value) {
+			TPointer<CompilerWorkerSplitDebug> retV;
+			retV.newMemory();
+			retV->fileName = value.fileName.value();
+			retV->copyFile = value.copyFile.value();
+			retV->echoCmd = value.echoCmd;
+			retV->super = value.super;
+			return retV;
+		};
+
+		TPointer<CompilerWorkerBool> compilerWorkerProcedureSplitDebug(CompilerWorkerSplitDebug *parameter, TAtomic<bool> &requestToTerminate) {
+			TPointer<CompilerWorkerBool> retV;
+			retV.newMemory();
+			if (parameter) {
+				int token = JobServer::acquire();
+				retV->value = parameter->super->splitDebugFile(
+				    parameter->fileName,
+				    parameter->echoCmd);
+				JobServer::release(token);
+				if (retV->value && (!parameter->copyFile.isEmpty())) {
+					retV->value = Shell::copy(parameter->fileName, parameter->copyFile);
+				};
+			};
+			return retV;
+		};
+
+	};
+
+	bool CompilerGCC::splitDebugInfo(
+	    int numThreads,
+	    bool echoCmd) {
+		size_t k;
+		TPointer<CompilerGCCWorker::CompilerWorkerSplitDebug> parameter;
+		TPointer<CompilerGCCWorker::CompilerWorkerBool> retVSplitDebug;
+		WorkerQueue splitDebugQueue;
+		splitDebugQueue.setNumberOfThreads(numThreads);
+
+		for (k = 0; k < splitDebugFiles.length(); ++k) {
+			parameter.newMemory();
+			parameter->super = this;
+			parameter->fileName = splitDebugFiles[k];
+			parameter->copyFile = splitDebugCopies[k];
+			parameter->echoCmd = echoCmd;
+			TWorkerQueue<CompilerGCCWorker::CompilerWorkerBool,
+			             CompilerGCCWorker::CompilerWorkerSplitDebug,
+			             CompilerGCCWorker::compilerTransferWorkerBool,
+			             CompilerGCCWorker::compilerTransferWorkerSplitDebug,
+			             CompilerGCCWorker::compilerWorkerProcedureSplitDebug>::add(splitDebugQueue, parameter);
+		};
+		splitDebugFiles.empty();
+		splitDebugCopies.empty();
+
+		if (splitDebugQueue.isEmpty()) {
+			return true;
+		};
+		if (!splitDebugQueue.process()) {
+			return false;
+		};
+		for (k = 0; k < splitDebugQueue.length(); ++k) {
+			retVSplitDebug = TStaticCast<CompilerGCCWorker::CompilerWorkerBool *>(splitDebugQueue.getReturnValue(k));
+			if (retVSplitDebug) {
+				if (!retVSplitDebug->value) {
+					return false;
+				};
+				continue;
+			};
+			return false;
+		};
+		return true;
+	};
+
+
+	bool CompilerGCC::makeCppToLib(
+	    String libName,
+	    String binPath,
+	    String libPath,
+	    String tmpPath,
+	    int options,
+	    TDynamicArray<String> &cppDefine,
+	    TDynamicArray<String> &incPath,
+	    TDynamicArray<String> &incFiles,
+	    TDynamicArray<String> &cppFiles,
+	    TDynamicArray<String> &rcDefine,
+	    TDynamicArray<String> &incPathRC,
+	    TDynamicArray<String> &rcFiles,
+	    String defFile,
+	    TDynamicArray<String> &libDependencyPath,
+	    TDynamicArray<String> &libDependency,
+	    String version,
+	    int numThreads,
+	    bool echoCmd,
+	    bool force) {
+		options = filterOptions(options);
+
+		size_t k;
+		TDynamicArray<String> objFiles;
+		String projectName = libName;
+
+		if (options & CompilerOptions::DynamicLibrary) {
+			projectName << ".so";
+		};
+		if (options & CompilerOptions::StaticLibrary) {
+			projectName << ".a";
+		};
+
+		if (!makeSourcesToObj(
+		        false,
+		        projectName,
+		        tmpPath,
+		        options,
+		        cppDefine,
+		        incPath,
+		        incFiles,
+		        cppFiles,
+		        objFiles,
+		        numThreads,
+		        echoCmd,
+		        force)) {
+			return false;
+		};
+
+		if (isOSWindows) {
+			if (options & CompilerOptions::DynamicLibrary) {
+				String resObj;
+				for (k = 0; k < rcFiles.length(); ++k) {
+
+					if (Shell::isChanged(rcFiles[k], incFiles)) {
+						Shell::touchIfExists(rcFiles[k]);
+					};
+
+					resObj = objFilename(projectName, rcFiles[k], tmpPath, options, (k + 1), rcFiles.length());
+
+					if (!makeRcToObj(
+					        rcFiles[k],
+					        resObj,
+					        rcDefine,
+					        incPathRC,
+					        echoCmd,
+					        force)) {
+						return false;
+					};
+
+					objFiles.push(resObj);
+				};
+			};
+		};
+
+		if (!makeObjToLib(
+		        libName,
+		        binPath,
+		        libPath,
+		        tmpPath,
+		        options,
+		        objFiles,
+		        defFile,
+		        libDependencyPath,
+		        libDependency,
+		        version,
+		        echoCmd,
+		        force)) {
+			return false;
+		};
+
+		if (options & CompilerOptions::ISALevel) {
+			return true;
+		};
+
+		for (k = 0; k < hwcaps.length(); ++k) {
+			if (!(options & CompilerOptions::DynamicLibrary)) {
+				break;
+			};
+			if ((!isOSLinux) || isOSEmscripten) {
+				break;
+			};
+			if (!makeCppToLib(
+			        libName,
+			        binPath + "/glibc-hwcaps/" + hwcaps[k],
+			        libPath,
+			        tmpPath + "/" + hwcaps[k],
+			        options | isaLevelOption(hwcaps[k]),
+			        cppDefine,
+			        incPath,
+			        incFiles,
+			        cppFiles,
+			        rcDefine,
+			        incPathRC,
+			        rcFiles,
+			        defFile,
+			        libDependencyPath,
+			        libDependency,
+			        version,
+			        numThreads,
+			        echoCmd,
+			        force)) {
+				return false;
+			};
+		};
+
+		return splitDebugInfo(numThreads, echoCmd);
+	};
+
+	bool CompilerGCC::makeCppToExe(
+	    String exeName,
+	    String binPath,
+	    String tmpPath,
+	    int options,
+	    TDynamicArray<String> &cppDefine,
+	    TDynamicArray<String> &incPath,
+	    TDynamicArray<String> &incFiles,
+	    TDynamicArray<String> &cppFiles,
+	    TDynamicArray<String> &rcDefine,
+	    TDynamicArray<String> &incPathRC,
+	    TDynamicArray<String> &rcFiles,
+	    TDynamicArray<String> &libDependencyPath,
+	    TDynamicArray<String> &libDependency,
+	    int numThreads,
+	    bool echoCmd,
+	    bool force) {
+		options = filterOptions(options);
+
+		size_t k;
+		TDynamicArray<String> objFiles;
+		String projectName = exeName;
+
+		if (!makeSourcesToObj(
+		        false,
+		        projectName,
+		        tmpPath,
+		        options,
+		        cppDefine,
+		        incPath,
+		        incFiles,
+		        cppFiles,
+		        objFiles,
+		        numThreads,
+		        echoCmd,
+		        force)) {
+			return false;
+		};
+
+		if (isOSWindows) {
+			String resObj;
+			for (k = 0; k < rcFiles.length(); ++k) {
+
+				if (Shell::isChanged(rcFiles[k], incFiles)) {
+					Shell::touchIfExists(rcFiles[k]);
+				};
+
+				resObj = objFilename(projectName, rcFiles[k], tmpPath, options, (k + 1), rcFiles.length());
+
+				if (!makeRcToObj(
+				        rcFiles[k],
+				        resObj,
+				        rcDefine,
+				        incPathRC,
+				        echoCmd,
+				        force)) {
+					return false;
+				};
+
+				objFiles.push(resObj);
+			};
+		};
+		if (!makeObjToExe(
+		        exeName,
+		        binPath,
+		        tmpPath,
+		        options,
+		        objFiles,
+		        libDependencyPath,
+		        libDependency,
+		        echoCmd,
+		        force)) {
+			return false;
+		};
+
+		return splitDebugInfo(numThreads, echoCmd);
+	};
+
+	bool CompilerGCC::cToObj(
+	    String cFile,
+	    String objFile,
+	    int options,
+	    TDynamicArray<String> &cDefine,
+	    TDynamicArray<String> &incPath,
+	    int index,
+	    int indexLn,
+	    bool echoCmd) {
+		String cmd;
+		String content;
+
+		options = filterOptions(options);
+		if (!Shell::mkdirFilePath(objFile)) {
+			return false;
+		};
+
+		cFile = cFile.replace("\\", "/");
+		objFile = objFile.replace("\\", "/");
+		cmd = ccCommand();
+		content = cFlags(options, cDefine, incPath);
+
+		String cmdFile = compileCmdFile(true, objFile);
+		char label[64];
+		snprintf(label, sizeof(label), "[%d/%d]", index, indexLn);
+		return compileToObj(cmd, content, cFile, objFile, cmdFile, label, echoCmd);
+	};
+
+	bool CompilerGCC::makeCToLib(
+	    String libName,
+	    String binPath,
+	    String libPath,
+	    String tmpPath,
+	    int options,
+	    TDynamicArray<String> &cDefine,
+	    TDynamicArray<String> &incPath,
+	    TDynamicArray<String> &incFiles,
+	    TDynamicArray<String> &cFiles,
+	    TDynamicArray<String> &rcDefine,
+	    TDynamicArray<String> &incPathRC,
+	    TDynamicArray<String> &rcFiles,
+	    String defFile,
+	    TDynamicArray<String> &libDependencyPath,
+	    TDynamicArray<String> &libDependency,
+	    String version,
+	    int numThreads,
+	    bool echoCmd,
+	    bool force) {
+		options = filterOptions(options);
+
+		size_t k;
+		TDynamicArray<String> objFiles;
+		String projectName = libName;
+
+		if (options & CompilerOptions::DynamicLibrary) {
+			projectName << ".so";
+		};
+		if (options & CompilerOptions::StaticLibrary) {
+			projectName << ".a";
+		};
+
+		if (!makeSourcesToObj(
+		        true,
+		        projectName,
+		        tmpPath,
+		        options,
+		        cDefine,
+		        incPath,
+		        incFiles,
+		        cFiles,
+		        objFiles,
+		        numThreads,
+		        echoCmd,
+		        force)) {
+			return false;
+		};
+
+		if (isOSWindows) {
+			if (options & CompilerOptions::DynamicLibrary) {
+				String resObj;
+				for (k = 0; k < rcFiles.length(); ++k) {
+
+					if (Shell::isChanged(rcFiles[k], incFiles)) {
+						Shell::touchIfExists(rcFiles[k]);
+					};
+
+					resObj = objFilename(projectName, rcFiles[k], tmpPath, options, (k + 1), rcFiles.length());
+
+					if (!makeRcToObj(
+					        rcFiles[k],
+					        resObj,
+					        rcDefine,
+					        incPathRC,
+					        echoCmd,
+					        force)) {
+						return false;
+					};
+
+					objFiles.push(resObj);
+				};
+			};
+		};
+
+		if (!makeObjToLib(
+		        libName,
+		        binPath,
+		        libPath,
+		        tmpPath,
+		        options,
+		        objFiles,
+		        defFile,
+		        libDependencyPath,
+		        libDependency,
+		        version,
+		        echoCmd,
+		        force)) {
+			return false;
+		};
+
+		return splitDebugInfo(numThreads, echoCmd);
+	};
+
+	bool CompilerGCC::makeCToExe(
+	    String exeName,
+	    String binPath,
+	    String tmpPath,
+	    int options,
+	    TDynamicArray<String> &cDefine,
+	    TDynamicArray<String> &incPath,
+	    TDynamicArray<String> &incFiles,
+	    TDynamicArray<String> &cFiles,
+	    TDynamicArray<String> &rcDefine,
+	    TDynamicArray<String> &incPathRC,
+	    TDynamicArray<String> &rcFiles,
+	    TDynamicArray<String> &libDependencyPath,
+	    TDynamicArray<String> &libDependency,
+	    int numThreads,
+	    bool echoCmd,
+	    bool force) {
+		options = filterOptions(options);
+
+		size_t k;
+		TDynamicArray<String> objFiles;
+		String projectName = exeName;
+
+		if (!makeSourcesToObj(
+		        true,
+		        projectName,
+		        tmpPath,
+		        options,
+		        cDefine,
+		        incPath,
+		        incFiles,
+		        cFiles,
+		        objFiles,
+		        numThreads,
+		        echoCmd,
+		        force)) {
+			return false;
+		};
+
+		if (isOSWindows) {
+			String resObj;
+			for (k = 0; k < rcFiles.length(); ++k) {
+
+				if (Shell::isChanged(rcFiles[k], incFiles)) {
+					Shell::touchIfExists(rcFiles[k]);
+				};
+
+				resObj = objFilename(projectName, rcFiles[k], tmpPath, options, (k + 1), rcFiles.length());
+
+				if (!makeRcToObj(
+				        rcFiles[k],
+				        resObj,
+				        rcDefine,
+				        incPathRC,
+				        echoCmd,
+				        force)) {
+					return false;
+				};
+
+				objFiles.push(resObj);
+			};
+		};
+
+		if (!makeObjToExe(
+		        exeName,
+		        binPath,
+		        tmpPath,
+		        options,
+		        objFiles,
+		        libDependencyPath,
+		        libDependency,
+		        echoCmd,
+		        force)) {
+			return false;
+		};
+
+		return splitDebugInfo(numThreads, echoCmd);
+	};
+
+};
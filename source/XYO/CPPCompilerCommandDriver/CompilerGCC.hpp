@@ -1,173 +1,335 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILERGCC_HPP
-#define XYO_CPPCOMPILERCOMMANDDRIVER_COMPILERGCC_HPP
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_ICOMPILER_HPP
-#	include <XYO/CPPCompilerCommandDriver/ICompiler.hpp>
-#endif
-
-namespace XYO::CPPCompilerCommandDriver {
-
-	class CompilerGCC : public virtual ICompiler {
-		public:
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT CompilerGCC();
-
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String objFilename(
-			    const String &project,
-			    const String &fileName,
-			    const String &tmpPath,
-			    int options,
-			    int index,
-			    int indexLn);
-
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool cppToObj(
-			    int options,
-			    String cppFile,
-			    String objFile,
-			    TDynamicArray<String> &cppDefine,
-			    TDynamicArray<String> &incPath,
-			    int index,
-			    int indexLn,
-			    bool echoCmd);
-
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeObjToLib(
-			    String libName,
-			    String binPath,
-			    String libPath,
-			    String tmpPath,
-			    int options,
-			    TDynamicArray<String> &objFiles,
-			    String defFile,
-			    TDynamicArray<String> &libDependencyPath,
-			    TDynamicArray<String> &libDependency,
-			    String version,
-			    bool echoCmd,
-			    bool force = false);
-
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeObjToExe(
-			    String exeName,
-			    String binPath,
-			    String tmpPath,
-			    int options,
-			    TDynamicArray<String> &objFiles,
-			    TDynamicArray<String> &libDependencyPath,
-			    TDynamicArray<String> &libDependency,
-			    bool echoCmd,
-			    bool force = false);
-
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool rcToRes(
-			    String rcFile,
-			    String resFile,
-			    TDynamicArray<String> &rcDefine,
-			    TDynamicArray<String> &incPath,
-			    bool echoCmd);
-
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool resToObj(
-			    String resFile,
-			    String objFile,
-			    bool echoCmd);
-
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeRcToObj(
-			    String rcFile,
-			    String objFile,
-			    TDynamicArray<String> &rcDefine,
-			    TDynamicArray<String> &incPath,
-			    bool echoCmd,
-			    bool force = false);
-
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeCppToLib(
-			    String libName,
-			    String binPath,
-			    String libPath,
-			    String tmpPath,
-			    int options,
-			    TDynamicArray<String> &cppDefine,
-			    TDynamicArray<String> &incPath,
-			    TDynamicArray<String> &incFiles,
-			    TDynamicArray<String> &cppFiles,
-			    TDynamicArray<String> &rcDefine,
-			    TDynamicArray<String> &incPathRC,
-			    TDynamicArray<String> &rcFiles,
-			    String defFile,
-			    TDynamicArray<String> &libDependencyPath,
-			    TDynamicArray<String> &libDependency,
-			    String version,
-			    int numThreads,
-			    bool echoCmd,
-			    bool force = false);
-
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeCppToExe(
-			    String exeName,
-			    String binPath,
-			    String tmpPath,
-			    int options,
-			    TDynamicArray<String> &cppDefine,
-			    TDynamicArray<String> &incPath,
-			    TDynamicArray<String> &incFiles,
-			    TDynamicArray<String> &cppFiles,
-			    TDynamicArray<String> &rcDefine,
-			    TDynamicArray<String> &incPathRC,
-			    TDynamicArray<String> &rcFiles,
-			    TDynamicArray<String> &libDependencyPath,
-			    TDynamicArray<String> &libDependency,
-			    int numThreads,
-			    bool echoCmd,
-			    bool force = false);
-
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool cToObj(
-			    String cppFile,
-			    String objFile,
-			    int options,
-			    TDynamicArray<String> &cDefine,
-			    TDynamicArray<String> &incPath,
-			    int index,
-			    int indexLn,
-			    bool echoCmd);
-
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeCToLib(
-			    String libName,
-			    String binPath,
-			    String libPath,
-			    String tmpPath,
-			    int options,
-			    TDynamicArray<String> &cDefine,
-			    TDynamicArray<String> &incPath,
-			    TDynamicArray<String> &incFiles,
-			    TDynamicArray<String> &cFiles,
-			    TDynamicArray<String> &rcDefine,
-			    TDynamicArray<String> &incPathRC,
-			    TDynamicArray<String> &rcFiles,
-			    String defFile,
-			    TDynamicArray<String> &libDependencyPath,
-			    TDynamicArray<String> &libDependency,
-			    String version,
-			    int numThreads,
-			    bool echoCmd,
-			    bool force = false);
-
-			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeCToExe(
-			    String exeName,
-			    String binPath,
-			    String tmpPath,
-			    int options,
-			    TDynamicArray<String> &cDefine,
-			    TDynamicArray<String> &incPath,
-			    TDynamicArray<String> &incFiles,
-			    TDynamicArray<String> &cFiles,
-			    TDynamicArray<String> &rcDefine,
-			    TDynamicArray<String> &incPathRC,
-			    TDynamicArray<String> &rcFiles,
-			    TDynamicArray<String> &libDependencyPath,
-			    TDynamicArray<String> &libDependency,
-			    int numThreads,
-			    bool echoCmd,
-			    bool force = false);
-	};
-};
-
-#endif
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILERGCC_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_COMPILERGCC_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_ICOMPILER_HPP
+#	include <XYO/CPPCompilerCommandDriver/ICompiler.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver {
+
+	class CompilerGCC : public virtual ICompiler {
+		public:
+			String precompiledHeaderInclude;
+			String moduleMapper;
+			String compilerIdentity;
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT CompilerGCC();
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String objFilename(
+			    const String &project,
+			    const String &fileName,
+			    const String &tmpPath,
+			    int options,
+			    int index,
+			    int indexLn);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool cppToObj(
+			    int options,
+			    String cppFile,
+			    String objFile,
+			    TDynamicArray<String> &cppDefine,
+			    TDynamicArray<String> &incPath,
+			    int index,
+			    int indexLn,
+			    bool echoCmd);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool compileToObj(
+			    String cmd,
+			    String flags,
+			    String sourceFile,
+			    String objFile,
+			    String cmdFile,
+			    String label,
+			    bool echoCmd);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void linkLibraryFiles(
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    TDynamicArray<String> &libFiles);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String linkCacheKey(
+			    String identity,
+			    String cmdFile,
+			    TDynamicArray<String> &inputs);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool linkCacheRestore(
+			    String key,
+			    String outFile,
+			    bool echoCmd);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void linkCacheStore(
+			    String key,
+			    String outFile);
+
+			// Process::system, recorded in the build trace as a job of category
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT int runCommand(
+			    const char *category,
+			    String name,
+			    String cmd,
+			    String outputFile);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String cxxCommand();
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String ccCommand();
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String linkerName();
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String arCommand();
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String ltoLinkFlags();
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String reproducibleFlags();
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String reproduciblePath(const String &value);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String cppFlags(
+			    int options,
+			    TDynamicArray<String> &cppDefine,
+			    TDynamicArray<String> &incPath);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String cFlags(
+			    int options,
+			    TDynamicArray<String> &cDefine,
+			    TDynamicArray<String> &incPath);
+
+			// Flags of cppToObj or cToObj, with the precompiled header
+			// and module mapper in use
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String compileFlags(
+			    bool isCSource,
+			    int options,
+			    TDynamicArray<String> &define,
+			    TDynamicArray<String> &incPath);
+
+			// Response file cmdFile is missing or has other content
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool isCmdFileChanged(
+			    String cmdFile,
+			    const String &content);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String compileCmdFile(
+			    bool isCSource,
+			    String objFile);
+
+			// The compile command differs from the one objFile was
+			// compiled with, recorded in its response file
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool isCompileChanged(
+			    bool isCSource,
+			    int options,
+			    TDynamicArray<String> &define,
+			    TDynamicArray<String> &incPath,
+			    String sourceFile,
+			    String objFile);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makePrecompiledHeader(
+			    String projectName,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &cppDefine,
+			    TDynamicArray<String> &incPath,
+			    bool echoCmd,
+			    bool force = false);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeSourcesToObj(
+			    bool isCSource,
+			    String projectName,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &define,
+			    TDynamicArray<String> &incPath,
+			    TDynamicArray<String> &incFiles,
+			    TDynamicArray<String> &srcFiles,
+			    TDynamicArray<String> &objFiles,
+			    int numThreads,
+			    bool echoCmd,
+			    bool force = false);
+
+			// Compile the sources of jobSource longest first by build
+			// history, killed jobs run again with fewer threads
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool compileJobs(
+			    bool isCSource,
+			    String projectName,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &define,
+			    TDynamicArray<String> &incPath,
+			    TDynamicArray<String> &srcFiles,
+			    TDynamicArray<String> &objFiles,
+			    TDynamicArray<size_t> &jobSource,
+			    int numThreads,
+			    bool echoCmd);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool scanModuleDependency(
+			    int options,
+			    String cppFile,
+			    String objFile,
+			    TDynamicArray<String> &cppDefine,
+			    TDynamicArray<String> &incPath,
+			    int index,
+			    int indexLn,
+			    bool echoCmd);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeHeaderUnit(
+			    String headerFile,
+			    String cmiFile,
+			    int options,
+			    TDynamicArray<String> &cppDefine,
+			    TDynamicArray<String> &incPath,
+			    bool echoCmd,
+			    bool force = false);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeModulesToObj(
+			    String projectName,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &define,
+			    TDynamicArray<String> &incPath,
+			    TDynamicArray<String> &incFiles,
+			    TDynamicArray<String> &srcFiles,
+			    TDynamicArray<String> &objFiles,
+			    int numThreads,
+			    bool echoCmd,
+			    bool force = false);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeObjToLib(
+			    String libName,
+			    String binPath,
+			    String libPath,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &objFiles,
+			    String defFile,
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    String version,
+			    bool echoCmd,
+			    bool force = false);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeObjToExe(
+			    String exeName,
+			    String binPath,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &objFiles,
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    bool echoCmd,
+			    bool force = false);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool splitDebugInfo(
+			    int numThreads,
+			    bool echoCmd);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool splitDebugFile(
+			    String fileName,
+			    bool echoCmd);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool rcToRes(
+			    String rcFile,
+			    String resFile,
+			    TDynamicArray<String> &rcDefine,
+			    TDynamicArray<String> &incPath,
+			    bool echoCmd);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool resToObj(
+			    String resFile,
+			    String objFile,
+			    bool echoCmd);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeRcToObj(
+			    String rcFile,
+			    String objFile,
+			    TDynamicArray<String> &rcDefine,
+			    TDynamicArray<String> &incPath,
+			    bool echoCmd,
+			    bool force = false);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeCppToLib(
+			    String libName,
+			    String binPath,
+			    String libPath,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &cppDefine,
+			    TDynamicArray<String> &incPath,
+			    TDynamicArray<String> &incFiles,
+			    TDynamicArray<String> &cppFiles,
+			    TDynamicArray<String> &rcDefine,
+			    TDynamicArray<String> &incPathRC,
+			    TDynamicArray<String> &rcFiles,
+			    String defFile,
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    String version,
+			    int numThreads,
+			    bool echoCmd,
+			    bool force = false);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeCppToExe(
+			    String exeName,
+			    String binPath,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &cppDefine,
+			    TDynamicArray<String> &incPath,
+			    TDynamicArray<String> &incFiles,
+			    TDynamicArray<String> &cppFiles,
+			    TDynamicArray<String> &rcDefine,
+			    TDynamicArray<String> &incPathRC,
+			    TDynamicArray<String> &rcFiles,
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    int numThreads,
+			    bool echoCmd,
+			    bool force = false);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool cToObj(
+			    String cppFile,
+			    String objFile,
+			    int options,
+			    TDynamicArray<String> &cDefine,
+			    TDynamicArray<String> &incPath,
+			    int index,
+			    int indexLn,
+			    bool echoCmd);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeCToLib(
+			    String libName,
+			    String binPath,
+			    String libPath,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &cDefine,
+			    TDynamicArray<String> &incPath,
+			    TDynamicArray<String> &incFiles,
+			    TDynamicArray<String> &cFiles,
+			    TDynamicArray<String> &rcDefine,
+			    TDynamicArray<String> &incPathRC,
+			    TDynamicArray<String> &rcFiles,
+			    String defFile,
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    String version,
+			    int numThreads,
+			    bool echoCmd,
+			    bool force = false);
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool makeCToExe(
+			    String exeName,
+			    String binPath,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &cDefine,
+			    TDynamicArray<String> &incPath,
+			    TDynamicArray<String> &incFiles,
+			    TDynamicArray<String> &cFiles,
+			    TDynamicArray<String> &rcDefine,
+			    TDynamicArray<String> &incPathRC,
+			    TDynamicArray<String> &rcFiles,
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    int numThreads,
+			    bool echoCmd,
+			    bool force = false);
+	};
+};
+
+#endif
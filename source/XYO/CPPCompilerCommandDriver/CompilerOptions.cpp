@@ -1,38 +1,65 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#include <XYO/CPPCompilerCommandDriver/CompilerOptions.hpp>
-
-namespace XYO::CPPCompilerCommandDriver {
-
-	int filterOptions(int options) {
-		int retV = 0;
-		if (options & CompilerOptions::Debug) {
-			retV |= CompilerOptions::Debug;
-		} else {
-			retV |= CompilerOptions::Release;
-		};
-		if (options & CompilerOptions::CRTStatic) {
-			retV |= CompilerOptions::CRTStatic;
-		} else {
-			retV |= CompilerOptions::CRTDynamic;
-		};
-		if (options & CompilerOptions::StaticLibrary) {
-			retV |= CompilerOptions::StaticLibrary;
-		} else {
-			retV |= CompilerOptions::DynamicLibrary;
-		};
-		if (options & CompilerOptions::DynamicLibraryXStatic) {
-			retV &= ~CompilerOptions::CRTDynamic;
-			retV &= ~CompilerOptions::StaticLibrary;
-			retV |= CompilerOptions::DynamicLibraryXStatic;
-			retV |= CompilerOptions::DynamicLibrary;
-			retV |= CompilerOptions::CRTStatic;
-		};
-		return retV;
-	};
-
-};
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/CompilerOptions.hpp>
+
+namespace XYO::CPPCompilerCommandDriver {
+
+	int filterOptions(int options) {
+		int retV = 0;
+		if (options & CompilerOptions::Debug) {
+			retV |= CompilerOptions::Debug;
+		} else {
+			retV |= CompilerOptions::Release;
+		};
+		if (options & CompilerOptions::CRTStatic) {
+			retV |= CompilerOptions::CRTStatic;
+		} else {
+			retV |= CompilerOptions::CRTDynamic;
+		};
+		if (options & CompilerOptions::StaticLibrary) {
+			retV |= CompilerOptions::StaticLibrary;
+		} else {
+			retV |= CompilerOptions::DynamicLibrary;
+		};
+		if (options & CompilerOptions::DynamicLibraryXStatic) {
+			retV &= ~CompilerOptions::CRTDynamic;
+			retV &= ~CompilerOptions::StaticLibrary;
+			retV |= CompilerOptions::DynamicLibraryXStatic;
+			retV |= CompilerOptions::DynamicLibrary;
+			retV |= CompilerOptions::CRTStatic;
+		};
+		retV |= (options & CompilerOptions::ISALevel);
+		return retV;
+	};
+
+	int isaLevelOption(const String &level) {
+		if (level == "x86-64-v2") {
+			return CompilerOptions::ISALevelX86_64_V2;
+		};
+		if (level == "x86-64-v3") {
+			return CompilerOptions::ISALevelX86_64_V3;
+		};
+		if (level == "x86-64-v4") {
+			return CompilerOptions::ISALevelX86_64_V4;
+		};
+		return CompilerOptions::None;
+	};
+
+	String isaLevelName(int options) {
+		if (options & CompilerOptions::ISALevelX86_64_V2) {
+			return "x86-64-v2";
+		};
+		if (options & CompilerOptions::ISALevelX86_64_V3) {
+			return "x86-64-v3";
+		};
+		if (options & CompilerOptions::ISALevelX86_64_V4) {
+			return "x86-64-v4";
+		};
+		return "";
+	};
+
+};
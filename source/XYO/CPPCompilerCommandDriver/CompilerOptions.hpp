@@ -1,31 +1,40 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILEROPTIONS_HPP
-#define XYO_CPPCOMPILERCOMMANDDRIVER_COMPILEROPTIONS_HPP
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
-#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
-#endif
-
-namespace XYO::CPPCompilerCommandDriver {
-
-	struct CompilerOptions {
-			static const int None = 0;
-			static const int Release = 1;
-			static const int Debug = 2;
-			static const int CRTDynamic = 4;
-			static const int CRTStatic = 8;
-			static const int StaticLibrary = 16;
-			static const int DynamicLibrary = 32;
-			static const int DynamicLibraryXStatic = 64;
-	};
-
-	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT int filterOptions(int options);
-
-};
-
-#endif
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILEROPTIONS_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_COMPILEROPTIONS_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver {
+
+	struct CompilerOptions {
+			static const int None = 0;
+			static const int Release = 1;
+			static const int Debug = 2;
+			static const int CRTDynamic = 4;
+			static const int CRTStatic = 8;
+			static const int StaticLibrary = 16;
+			static const int DynamicLibrary = 32;
+			static const int DynamicLibraryXStatic = 64;
+			// glibc-hwcaps ISA level of a dynamic library variant
+			static const int ISALevelX86_64_V2 = 128;
+			static const int ISALevelX86_64_V3 = 256;
+			static const int ISALevelX86_64_V4 = 512;
+			static const int ISALevel = ISALevelX86_64_V2 | ISALevelX86_64_V3 | ISALevelX86_64_V4;
+	};
+
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT int filterOptions(int options);
+	// Option of a level name (x86-64-v2, ...), None if not supported
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT int isaLevelOption(const String &level);
+	// Level name of options, empty for baseline
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String isaLevelName(int options);
+
+};
+
+#endif
@@ -0,0 +1,79 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/DepFile.hpp>
+
+namespace XYO::CPPCompilerCommandDriver::DepFile {
+
+	bool read(const String &fileName, TDynamicArray<String> &dependency) {
+		String content;
+		const char *scan;
+		bool isTarget;
+		std::string token;
+
+		if (!Shell::fileGetContents(fileName, content)) {
+			return false;
+		};
+
+		isTarget = true;
+		scan = content.value();
+		while (*scan) {
+			if (*scan == '\\') {
+				if ((scan[1] == '\n') || (scan[1] == '\r')) {
+					scan += (scan[1] == '\r' && scan[2] == '\n') ? 3 : 2;
+					if (!token.empty()) {
+						if (!isTarget) {
+							dependency.push(token.c_str());
+						};
+						token.clear();
+					};
+					continue;
+				};
+				if (scan[1] == ' ' || scan[1] == '#') {
+					token += scan[1];
+					scan += 2;
+					continue;
+				};
+			};
+			if ((*scan == '$') && (scan[1] == '$')) {
+				token += '$';
+				scan += 2;
+				continue;
+			};
+			if (isTarget && (*scan == ':') && ((scan[1] == ' ') || (scan[1] == '\t') || (scan[1] == '\r') || (scan[1] == '\n') || (scan[1] == 0))) {
+				isTarget = false;
+				token.clear();
+				++scan;
+				continue;
+			};
+			if ((*scan == ' ') || (*scan == '\t') || (*scan == '\r') || (*scan == '\n')) {
+				if (!token.empty()) {
+					if (!isTarget) {
+						if (token[token.length() - 1] != ':') {
+							dependency.push(token.c_str());
+						};
+					};
+					token.clear();
+				};
+				if ((*scan == '\n') && (!isTarget)) {
+					isTarget = true;
+				};
+				++scan;
+				continue;
+			};
+			token += *scan;
+			++scan;
+		};
+		if (!token.empty()) {
+			if (!isTarget) {
+				dependency.push(token.c_str());
+			};
+		};
+
+		return true;
+	};
+
+};
@@ -0,0 +1,21 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPFILE_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_DEPFILE_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::DepFile {
+
+	// Read prerequisites from a make rule file written by -MD/-MF
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool read(const String &fileName, TDynamicArray<String> &dependency);
+
+};
+
+#endif
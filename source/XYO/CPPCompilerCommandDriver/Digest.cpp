@@ -0,0 +1,151 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/Digest.hpp>
+
+namespace XYO::CPPCompilerCommandDriver::Digest {
+
+	static const uint32_t sha256K[64] = {
+	    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+	static inline uint32_t rotateRight(uint32_t x, int n) {
+		return (x >> n) | (x << (32 - n));
+	};
+
+	SHA256::SHA256() {
+		state[0] = 0x6a09e667;
+		state[1] = 0xbb67ae85;
+		state[2] = 0x3c6ef372;
+		state[3] = 0xa54ff53a;
+		state[4] = 0x510e527f;
+		state[5] = 0x9b05688c;
+		state[6] = 0x1f83d9ab;
+		state[7] = 0x5be0cd19;
+		blockLength = 0;
+		totalLength = 0;
+	};
+
+	void SHA256::processBlock(const uint8_t *data) {
+		uint32_t w[64];
+		uint32_t a, b, c, d, e, f, g, h, t1, t2;
+		int k;
+
+		for (k = 0; k < 16; ++k) {
+			w[k] = ((uint32_t)data[k * 4] << 24) | ((uint32_t)data[k * 4 + 1] << 16) | ((uint32_t)data[k * 4 + 2] << 8) | ((uint32_t)data[k * 4 + 3]);
+		};
+		for (k = 16; k < 64; ++k) {
+			w[k] = w[k - 16] + (rotateRight(w[k - 15], 7) ^ rotateRight(w[k - 15], 18) ^ (w[k - 15] >> 3)) + w[k - 7] + (rotateRight(w[k - 2], 17) ^ rotateRight(w[k - 2], 19) ^ (w[k - 2] >> 10));
+		};
+
+		a = state[0];
+		b = state[1];
+		c = state[2];
+		d = state[3];
+		e = state[4];
+		f = state[5];
+		g = state[6];
+		h = state[7];
+
+		for (k = 0; k < 64; ++k) {
+			t1 = h + (rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25)) + ((e & f) ^ ((~e) & g)) + sha256K[k] + w[k];
+			t2 = (rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+			h = g;
+			g = f;
+			f = e;
+			e = d + t1;
+			d = c;
+			c = b;
+			b = a;
+			a = t1 + t2;
+		};
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
+	};
+
+	void SHA256::update(const void *data, size_t size) {
+		const uint8_t *input = (const uint8_t *)data;
+		totalLength += size;
+		while (size > 0) {
+			size_t toCopy = 64 - blockLength;
+			if (toCopy > size) {
+				toCopy = size;
+			};
+			memcpy(&block[blockLength], input, toCopy);
+			blockLength += toCopy;
+			input += toCopy;
+			size -= toCopy;
+			if (blockLength == 64) {
+				processBlock(block);
+				blockLength = 0;
+			};
+		};
+	};
+
+	void SHA256::update(const String &value) {
+		update(value.value(), value.length());
+	};
+
+	String SHA256::hexDigest() {
+		uint64_t bitLength = totalLength * 8;
+		uint8_t padding[72];
+		size_t paddingLength;
+		int k;
+
+		paddingLength = (blockLength < 56) ? (56 - blockLength) : (120 - blockLength);
+		memset(padding, 0, sizeof(padding));
+		padding[0] = 0x80;
+		for (k = 0; k < 8; ++k) {
+			padding[paddingLength + k] = (uint8_t)(bitLength >> (56 - k * 8));
+		};
+		update(padding, paddingLength + 8);
+
+		char hex[65];
+		for (k = 0; k < 8; ++k) {
+			sprintf(&hex[k * 8], "%08x", (unsigned int)state[k]);
+		};
+		hex[64] = 0;
+		return hex;
+	};
+
+	String sha256(const String &value) {
+		SHA256 digest;
+		digest.update(value);
+		return digest.hexDigest();
+	};
+
+	bool sha256File(const String &fileName, String &digest) {
+		FILE *in;
+		uint8_t buffer[32768];
+		size_t readLength;
+		SHA256 hash;
+
+		in = fopen(fileName.value(), "rb");
+		if (!in) {
+			return false;
+		};
+		while ((readLength = fread(buffer, 1, sizeof(buffer), in)) > 0) {
+			hash.update(buffer, readLength);
+		};
+		fclose(in);
+		digest = hash.hexDigest();
+		return true;
+	};
+
+};
@@ -0,0 +1,38 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DIGEST_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_DIGEST_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::Digest {
+
+	class SHA256 {
+		public:
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT SHA256();
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void update(const void *data, size_t size);
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void update(const String &value);
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String hexDigest();
+
+		protected:
+			uint32_t state[8];
+			uint8_t block[64];
+			size_t blockLength;
+			uint64_t totalLength;
+
+			void processBlock(const uint8_t *data);
+	};
+
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String sha256(const String &value);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool sha256File(const String &fileName, String &digest);
+
+};
+
+#endif
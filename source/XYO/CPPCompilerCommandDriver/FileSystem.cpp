@@ -0,0 +1,253 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/FileSystem.hpp>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#ifdef XYO_PLATFORM_OS_WINDOWS
+#	include <windows.h>
+#	include <direct.h>
+#	include <io.h>
+#	include <process.h>
+#else
+#	include <unistd.h>
+#	include <dirent.h>
+#	include <fcntl.h>
+#	include <sys/ioctl.h>
+#endif
+#ifdef XYO_PLATFORM_OS_LINUX
+#	include <linux/fs.h>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::FileSystem {
+
+	bool getFileSize(const String &fileName, uint64_t &size) {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		struct _stat64 info;
+		if (_stat64(fileName.value(), &info) != 0) {
+			return false;
+		};
+#else
+		struct stat info;
+		if (stat(fileName.value(), &info) != 0) {
+			return false;
+		};
+#endif
+		size = (uint64_t)info.st_size;
+		return true;
+	};
+
+	bool getLastWriteTime(const String &fileName, int64_t &time) {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		struct _stat64 info;
+		if (_stat64(fileName.value(), &info) != 0) {
+			return false;
+		};
+#else
+		struct stat info;
+		if (stat(fileName.value(), &info) != 0) {
+			return false;
+		};
+#endif
+		time = (int64_t)info.st_mtime;
+		return true;
+	};
+
+	int64_t getTime() {
+		return (int64_t)::time(nullptr);
+	};
+
+	uint64_t getMilliseconds() {
+		return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	};
+
+	uint64_t getMicroseconds() {
+		return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	};
+
+	String getCurrentDirectory() {
+		char buffer[4096];
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		if (!_getcwd(buffer, sizeof(buffer))) {
+			return ".";
+		};
+#else
+		if (!getcwd(buffer, sizeof(buffer))) {
+			return ".";
+		};
+#endif
+		return String(buffer).replace("\\", "/");
+	};
+
+	bool isAbsolutePath(const String &path) {
+		if (path.length() == 0) {
+			return false;
+		};
+		if ((path[0] == '/') || (path[0] == '\\')) {
+			return true;
+		};
+		if (path.length() > 1) {
+			if (path[1] == ':') {
+				return true;
+			};
+		};
+		return false;
+	};
+
+	String absolutePath(const String &path) {
+		String retV;
+		if (isAbsolutePath(path)) {
+			return path.replace("\\", "/");
+		};
+		retV = getCurrentDirectory();
+		retV << "/" << path.replace("\\", "/");
+		retV = retV.replace("/./", "/");
+		return retV;
+	};
+
+	bool renameFile(const String &fileName, const String &newName) {
+		return (rename(fileName.value(), newName.value()) == 0);
+	};
+
+	int getProcessId() {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		return _getpid();
+#else
+		return (int)getpid();
+#endif
+	};
+
+	bool listFiles(const String &path, TDynamicArray<String> &files) {
+		files.empty();
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		struct _finddata_t data;
+		intptr_t handle;
+		String search = path + "/*";
+		handle = _findfirst(search.value(), &data);
+		if (handle == -1) {
+			return false;
+		};
+		do {
+			if (data.attrib & _A_SUBDIR) {
+				continue;
+			};
+			files.push(data.name);
+		} while (_findnext(handle, &data) == 0);
+		_findclose(handle);
+#else
+		DIR *dir;
+		struct dirent *entry;
+		struct stat info;
+		dir = opendir(path.value());
+		if (!dir) {
+			return false;
+		};
+		while ((entry = readdir(dir)) != nullptr) {
+			if ((strcmp(entry->d_name, ".") == 0) || (strcmp(entry->d_name, "..") == 0)) {
+				continue;
+			};
+			String fileName = path + "/" + entry->d_name;
+			if (stat(fileName.value(), &info) != 0) {
+				continue;
+			};
+			if (!S_ISREG(info.st_mode)) {
+				continue;
+			};
+			files.push(entry->d_name);
+		};
+		closedir(dir);
+#endif
+		return true;
+	};
+
+	bool cloneFile(const String &fileName, const String &newName) {
+#if defined(XYO_PLATFORM_OS_LINUX) && defined(FICLONE)
+		struct stat info;
+		int source;
+		int target;
+		source = open(fileName.value(), O_RDONLY);
+		if (source < 0) {
+			return false;
+		};
+		if (fstat(source, &info) != 0) {
+			close(source);
+			return false;
+		};
+		target = open(newName.value(), O_WRONLY | O_CREAT | O_EXCL, info.st_mode & 0777);
+		if (target < 0) {
+			close(source);
+			return false;
+		};
+		if (ioctl(target, FICLONE, source) != 0) {
+			close(target);
+			close(source);
+			unlink(newName.value());
+			return false;
+		};
+		close(target);
+		close(source);
+		return true;
+#else
+		return false;
+#endif
+	};
+
+	bool linkFile(const String &fileName, const String &newName) {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		return (CreateHardLinkA(newName.value(), fileName.value(), nullptr) != 0);
+#else
+		return (link(fileName.value(), newName.value()) == 0);
+#endif
+	};
+
+	bool setReadOnly(const String &fileName) {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		// Read-only files can not be removed or touched on windows,
+		// cache entries stay writable and are restored by copy
+		return false;
+#else
+		struct stat info;
+		if (stat(fileName.value(), &info) != 0) {
+			return false;
+		};
+		return (chmod(fileName.value(), info.st_mode & 0555) == 0);
+#endif
+	};
+
+	bool isReadOnly(const String &fileName) {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		struct _stat64 info;
+		if (_stat64(fileName.value(), &info) != 0) {
+			return false;
+		};
+		return ((info.st_mode & _S_IWRITE) == 0);
+#else
+		struct stat info;
+		if (stat(fileName.value(), &info) != 0) {
+			return false;
+		};
+		return ((info.st_mode & 0222) == 0);
+#endif
+	};
+
+	bool copyMode(const String &fileName, const String &newName) {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		return true;
+#else
+		struct stat info;
+		if (stat(fileName.value(), &info) != 0) {
+			return false;
+		};
+		return (chmod(newName.value(), (info.st_mode & 0777) | 0200) == 0);
+#endif
+	};
+
+};
@@ -0,0 +1,39 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_FILESYSTEM_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_FILESYSTEM_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::FileSystem {
+
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool getFileSize(const String &fileName, uint64_t &size);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool getLastWriteTime(const String &fileName, int64_t &time);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT int64_t getTime();
+	// Monotonic clock, for durations
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT uint64_t getMilliseconds();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT uint64_t getMicroseconds();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String getCurrentDirectory();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool isAbsolutePath(const String &path);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String absolutePath(const String &path);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool renameFile(const String &fileName, const String &newName);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT int getProcessId();
+	// Names of regular files in path
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool listFiles(const String &path, TDynamicArray<String> &files);
+	// Copy on write clone (FICLONE), fails if not supported by the filesystem
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool cloneFile(const String &fileName, const String &newName);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool linkFile(const String &fileName, const String &newName);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool setReadOnly(const String &fileName);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool isReadOnly(const String &fileName);
+	// Permissions of fileName, writable by owner, to newName
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool copyMode(const String &fileName, const String &newName);
+
+};
+
+#endif
@@ -1,189 +1,229 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_ICOMPILER_HPP
-#define XYO_CPPCOMPILERCOMMANDDRIVER_ICOMPILER_HPP
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
-#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
-#endif
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILEROPTIONS_HPP
-#	include <XYO/CPPCompilerCommandDriver/CompilerOptions.hpp>
-#endif
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILERTYPE_HPP
-#	include <XYO/CPPCompilerCommandDriver/CompilerType.hpp>
-#endif
-
-namespace XYO::CPPCompilerCommandDriver {
-
-	class ICompiler : public virtual Object {
-			XYO_PLATFORM_INTERFACE(ICompiler);
-
-		public:
-			int type;
-			bool isOSWindows;
-			bool isOSLinux;
-			bool isOSEmscripten;
-			bool is32Bit;
-			bool is64Bit;
-			bool isStatic;
-
-			virtual String objFilename(
-			    const String &project,
-			    const String &fileName,
-			    const String &tmpPath,
-			    int options,
-			    int index,
-			    int indexLn) = 0;
-
-			virtual bool cppToObj(
-			    int options,
-			    String cppFile,
-			    String objFile,
-			    TDynamicArray<String> &cppDefine,
-			    TDynamicArray<String> &incPath,
-			    int index,
-			    int indexLn,
-			    bool echoCmd) = 0;
-
-			virtual bool makeObjToLib(
-			    String libName,
-			    String binPath,
-			    String libPath,
-			    String tmpPath,
-			    int options,
-			    TDynamicArray<String> &objFiles,
-			    String defFile,
-			    TDynamicArray<String> &libDependencyPath,
-			    TDynamicArray<String> &libDependency,
-			    String version,
-			    bool echoCmd,
-			    bool force = false) = 0;
-
-			virtual bool makeObjToExe(
-			    String exeName,
-			    String binPath,
-			    String tmpPath,
-			    int options,
-			    TDynamicArray<String> &objFiles,
-			    TDynamicArray<String> &libDependencyPath,
-			    TDynamicArray<String> &libDependency,
-			    bool echoCmd,
-			    bool force = false) = 0;
-
-			virtual bool rcToRes(
-			    String rcFile,
-			    String resFile,
-			    TDynamicArray<String> &rcDefine,
-			    TDynamicArray<String> &incPath,
-			    bool echoCmd) = 0;
-
-			virtual bool resToObj(
-			    String resFile,
-			    String objFile,
-			    bool echoCmd) = 0;
-
-			virtual bool makeRcToObj(
-			    String rcFile,
-			    String objFile,
-			    TDynamicArray<String> &rcDefine,
-			    TDynamicArray<String> &incPath,
-			    bool echoCmd,
-			    bool force = false) = 0;
-
-			virtual bool makeCppToLib(
-			    String libName,
-			    String binPath,
-			    String libPath,
-			    String tmpPath,
-			    int options,
-			    TDynamicArray<String> &cppDefine,
-			    TDynamicArray<String> &incPath,
-			    TDynamicArray<String> &incFiles,
-			    TDynamicArray<String> &cppFiles,
-			    TDynamicArray<String> &rcDefine,
-			    TDynamicArray<String> &incPathRC,
-			    TDynamicArray<String> &rcFiles,
-			    String defFile,
-			    TDynamicArray<String> &libDependencyPath,
-			    TDynamicArray<String> &libDependency,
-			    String version,
-			    int numThreads,
-			    bool echoCmd,
-			    bool force = false) = 0;
-
-			virtual bool makeCppToExe(
-			    String exeName,
-			    String binPath,
-			    String tmpPath,
-			    int options,
-			    TDynamicArray<String> &cppDefine,
-			    TDynamicArray<String> &incPath,
-			    TDynamicArray<String> &incFiles,
-			    TDynamicArray<String> &cppFiles,
-			    TDynamicArray<String> &rcDefine,
-			    TDynamicArray<String> &incPathRC,
-			    TDynamicArray<String> &rcFiles,
-			    TDynamicArray<String> &libDependencyPath,
-			    TDynamicArray<String> &libDependency,
-			    int numThreads,
-			    bool echoCmd,
-			    bool force = false) = 0;
-
-			virtual bool cToObj(
-			    String cppFile,
-			    String objFile,
-			    int options,
-			    TDynamicArray<String> &cDefine,
-			    TDynamicArray<String> &incPath,
-			    int index,
-			    int indexLn,
-			    bool echoCmd) = 0;
-
-			virtual bool makeCToLib(
-			    String libName,
-			    String binPath,
-			    String libPath,
-			    String tmpPath,
-			    int options,
-			    TDynamicArray<String> &cDefine,
-			    TDynamicArray<String> &incPath,
-			    TDynamicArray<String> &incFiles,
-			    TDynamicArray<String> &cFiles,
-			    TDynamicArray<String> &rcDefine,
-			    TDynamicArray<String> &incPathRC,
-			    TDynamicArray<String> &rcFiles,
-			    String defFile,
-			    TDynamicArray<String> &libDependencyPath,
-			    TDynamicArray<String> &libDependency,
-			    String version,
-			    int numThreads,
-			    bool echoCmd,
-			    bool force = false) = 0;
-
-			virtual bool makeCToExe(
-			    String exeName,
-			    String binPath,
-			    String tmpPath,
-			    int options,
-			    TDynamicArray<String> &cDefine,
-			    TDynamicArray<String> &incPath,
-			    TDynamicArray<String> &incFiles,
-			    TDynamicArray<String> &cFiles,
-			    TDynamicArray<String> &rcDefine,
-			    TDynamicArray<String> &incPathRC,
-			    TDynamicArray<String> &rcFiles,
-			    TDynamicArray<String> &libDependencyPath,
-			    TDynamicArray<String> &libDependency,
-			    int numThreads,
-			    bool echoCmd,
-			    bool force = false) = 0;
-	};
-};
-
-#endif
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_ICOMPILER_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_ICOMPILER_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILEROPTIONS_HPP
+#	include <XYO/CPPCompilerCommandDriver/CompilerOptions.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILERTYPE_HPP
+#	include <XYO/CPPCompilerCommandDriver/CompilerType.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver {
+
+	class ICompiler : public virtual Object {
+			XYO_PLATFORM_INTERFACE(ICompiler);
+
+		public:
+			int type;
+			bool isOSWindows;
+			bool isOSLinux;
+			bool isOSEmscripten;
+			bool is32Bit;
+			bool is64Bit;
+			bool isStatic;
+
+			// glibc-hwcaps subdirectories (x86-64-v2, ...) to build dynamic libraries for
+			TDynamicArray<String> hwcaps;
+			// linker symbol ordering file, one symbol per line
+			String symbolOrderingFile;
+			// linker to use (bfd, gold, lld, ...), empty for default
+			String linker;
+			// align executable segments to 2 MiB for transparent huge pages
+			bool hugePageText;
+			// header to precompile and include in every c++ source
+			String precompiledHeader;
+			// move debug info of linked outputs to separate .debug files
+			bool splitDebug;
+			TDynamicArray<String> splitDebugFiles;
+			// copy of each split file to make after it is split, empty for none
+			TDynamicArray<String> splitDebugCopies;
+			// c++ language standard (c++17, c++20, gnu++20, ...), empty for default
+			String standard;
+			// c++20 modules, interfaces are compiled before their importers
+			bool modules;
+			// headers (as included) to compile as header units for modules
+			TDynamicArray<String> headerUnits;
+			// compile cache folder, empty for no cache
+			String cachePath;
+			// compile cache size limit in bytes, 0 for no limit
+			uint64_t cacheSize;
+			// remote compile cache url, empty for local cache only
+			String remoteCache;
+			// reproducible outputs, paths under root are mapped to ., empty for off
+			String reproducibleRoot;
+			// link time optimization, parallel jobs of the link come from the jobserver
+			bool lto;
+			// after a failed compile no new compile starts, failFast also
+			// terminates the running ones, keepGoing compiles all it can
+			bool failFast;
+			bool keepGoing;
+
+			virtual String objFilename(
+			    const String &project,
+			    const String &fileName,
+			    const String &tmpPath,
+			    int options,
+			    int index,
+			    int indexLn) = 0;
+
+			virtual bool cppToObj(
+			    int options,
+			    String cppFile,
+			    String objFile,
+			    TDynamicArray<String> &cppDefine,
+			    TDynamicArray<String> &incPath,
+			    int index,
+			    int indexLn,
+			    bool echoCmd) = 0;
+
+			virtual bool makeObjToLib(
+			    String libName,
+			    String binPath,
+			    String libPath,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &objFiles,
+			    String defFile,
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    String version,
+			    bool echoCmd,
+			    bool force = false) = 0;
+
+			virtual bool makeObjToExe(
+			    String exeName,
+			    String binPath,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &objFiles,
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    bool echoCmd,
+			    bool force = false) = 0;
+
+			virtual bool splitDebugInfo(
+			    int numThreads,
+			    bool echoCmd) = 0;
+
+			virtual bool rcToRes(
+			    String rcFile,
+			    String resFile,
+			    TDynamicArray<String> &rcDefine,
+			    TDynamicArray<String> &incPath,
+			    bool echoCmd) = 0;
+
+			virtual bool resToObj(
+			    String resFile,
+			    String objFile,
+			    bool echoCmd) = 0;
+
+			virtual bool makeRcToObj(
+			    String rcFile,
+			    String objFile,
+			    TDynamicArray<String> &rcDefine,
+			    TDynamicArray<String> &incPath,
+			    bool echoCmd,
+			    bool force = false) = 0;
+
+			virtual bool makeCppToLib(
+			    String libName,
+			    String binPath,
+			    String libPath,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &cppDefine,
+			    TDynamicArray<String> &incPath,
+			    TDynamicArray<String> &incFiles,
+			    TDynamicArray<String> &cppFiles,
+			    TDynamicArray<String> &rcDefine,
+			    TDynamicArray<String> &incPathRC,
+			    TDynamicArray<String> &rcFiles,
+			    String defFile,
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    String version,
+			    int numThreads,
+			    bool echoCmd,
+			    bool force = false) = 0;
+
+			virtual bool makeCppToExe(
+			    String exeName,
+			    String binPath,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &cppDefine,
+			    TDynamicArray<String> &incPath,
+			    TDynamicArray<String> &incFiles,
+			    TDynamicArray<String> &cppFiles,
+			    TDynamicArray<String> &rcDefine,
+			    TDynamicArray<String> &incPathRC,
+			    TDynamicArray<String> &rcFiles,
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    int numThreads,
+			    bool echoCmd,
+			    bool force = false) = 0;
+
+			virtual bool cToObj(
+			    String cppFile,
+			    String objFile,
+			    int options,
+			    TDynamicArray<String> &cDefine,
+			    TDynamicArray<String> &incPath,
+			    int index,
+			    int indexLn,
+			    bool echoCmd) = 0;
+
+			virtual bool makeCToLib(
+			    String libName,
+			    String binPath,
+			    String libPath,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &cDefine,
+			    TDynamicArray<String> &incPath,
+			    TDynamicArray<String> &incFiles,
+			    TDynamicArray<String> &cFiles,
+			    TDynamicArray<String> &rcDefine,
+			    TDynamicArray<String> &incPathRC,
+			    TDynamicArray<String> &rcFiles,
+			    String defFile,
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    String version,
+			    int numThreads,
+			    bool echoCmd,
+			    bool force = false) = 0;
+
+			virtual bool makeCToExe(
+			    String exeName,
+			    String binPath,
+			    String tmpPath,
+			    int options,
+			    TDynamicArray<String> &cDefine,
+			    TDynamicArray<String> &incPath,
+			    TDynamicArray<String> &incFiles,
+			    TDynamicArray<String> &cFiles,
+			    TDynamicArray<String> &rcDefine,
+			    TDynamicArray<String> &incPathRC,
+			    TDynamicArray<String> &rcFiles,
+			    TDynamicArray<String> &libDependencyPath,
+			    TDynamicArray<String> &libDependency,
+			    int numThreads,
+			    bool echoCmd,
+			    bool force = false) = 0;
+	};
+};
+
+#endif
@@ -0,0 +1,279 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/JobServer.hpp>
+#include <XYO/CPPCompilerCommandDriver/FileSystem.hpp>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef XYO_PLATFORM_OS_WINDOWS
+#	include <windows.h>
+#else
+#	include <unistd.h>
+#	include <fcntl.h>
+#	include <errno.h>
+#	include <poll.h>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::JobServer {
+
+	namespace JobServerX {
+
+		static const int implicitToken = -1;
+		static const int noToken = -2;
+
+		static bool active = false;
+		static bool client = false;
+		static String auth;
+		// The token of this process, taken without the pipe
+		static TAtomic<bool> implicitFree;
+		static CriticalSection implicitLock;
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		static HANDLE semaphore = nullptr;
+#else
+		static int readFd = -1;
+		static int writeFd = -1;
+		static bool ownFd = false;
+#endif
+
+		static String authFromMakeFlags(const String &makeFlags) {
+			const char *option[2] = {"--jobserver-auth=", "--jobserver-fds="};
+			String retV;
+			size_t index;
+			size_t end;
+			size_t start;
+			int k;
+
+			// The last option wins, as for make
+			for (k = 0; k < 2; ++k) {
+				start = 0;
+				while (makeFlags.indexOf(option[k], start, index)) {
+					index += strlen(option[k]);
+					if (!makeFlags.indexOf(" ", index, end)) {
+						end = makeFlags.length();
+					};
+					retV = makeFlags.substring(index, end - index);
+					start = end;
+				};
+				if (!retV.isEmpty()) {
+					break;
+				};
+			};
+			return retV;
+		};
+
+		// Remove the jobserver options of make, to replace them with ours
+		static String withoutAuth(const String &makeFlags) {
+			TDynamicArray<String> flags;
+			String retV;
+			size_t k;
+
+			makeFlags.explode(" ", flags);
+			for (k = 0; k < flags.length(); ++k) {
+				if (flags[k].beginWith("--jobserver-auth=") || flags[k].beginWith("--jobserver-fds=") || flags[k].beginWith("-j")) {
+					continue;
+				};
+				retV << " " << flags[k];
+			};
+			return retV;
+		};
+
+		static bool setMakeFlags(const String &value) {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+			return (_putenv_s("MAKEFLAGS", value.value()) == 0);
+#else
+			return (setenv("MAKEFLAGS", value.value(), 1) == 0);
+#endif
+		};
+
+	};
+
+	using namespace JobServerX;
+
+	bool start(int jobs) {
+		String makeFlags = Shell::getEnv("MAKEFLAGS");
+		char buffer[128];
+
+		if (active) {
+			return true;
+		};
+		if (jobs < 1) {
+			jobs = 1;
+		};
+		implicitFree.set(true);
+
+		auth = authFromMakeFlags(makeFlags);
+		if (!auth.isEmpty()) {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+			semaphore = OpenSemaphoreA(SEMAPHORE_ALL_ACCESS, FALSE, auth.value());
+			if (!semaphore) {
+				printf("Warning: jobserver semaphore not available - %s\n", auth.value());
+				return false;
+			};
+#else
+			if (auth.beginWith("fifo:")) {
+				readFd = open(auth.index(5), O_RDWR | O_CLOEXEC);
+				if (readFd < 0) {
+					printf("Warning: jobserver fifo not available - %s\n", auth.index(5));
+					return false;
+				};
+				writeFd = readFd;
+				ownFd = true;
+			} else {
+				// Make closes the pipe for commands not marked recursive by +
+				if (sscanf(auth.value(), "%d,%d", &readFd, &writeFd) != 2) {
+					printf("Warning: jobserver auth not valid - %s\n", auth.value());
+					return false;
+				};
+				if ((readFd < 0) || (writeFd < 0) || (fcntl(readFd, F_GETFD) == -1) || (fcntl(writeFd, F_GETFD) == -1)) {
+					printf("Warning: jobserver pipe not available, mark the make rule with +\n");
+					readFd = -1;
+					writeFd = -1;
+					return false;
+				};
+				ownFd = false;
+			};
+#endif
+			client = true;
+			active = true;
+			return true;
+		};
+
+		// Serve jobs slots, one is the implicit slot of this process
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		snprintf(buffer, sizeof(buffer), "xyo-cc-jobserver-%d", FileSystem::getProcessId());
+		semaphore = CreateSemaphoreA(nullptr, jobs - 1, (jobs > 1) ? (jobs - 1) : 1, buffer);
+		if (!semaphore) {
+			return false;
+		};
+		auth = buffer;
+#else
+		int fd[2];
+		int k;
+		if (pipe(fd) != 0) {
+			return false;
+		};
+		readFd = fd[0];
+		writeFd = fd[1];
+		ownFd = true;
+		for (k = 1; k < jobs; ++k) {
+			if (write(writeFd, "+", 1) != 1) {
+				break;
+			};
+		};
+		snprintf(buffer, sizeof(buffer), "%d,%d", readFd, writeFd);
+		auth = buffer;
+#endif
+		snprintf(buffer, sizeof(buffer), " -j%d --jobserver-auth=", jobs);
+		setMakeFlags(withoutAuth(makeFlags) + buffer + auth);
+		client = false;
+		active = true;
+		return true;
+	};
+
+	void stop() {
+		if (!active) {
+			return;
+		};
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		CloseHandle(semaphore);
+		semaphore = nullptr;
+#else
+		if (ownFd) {
+			close(readFd);
+			if (writeFd != readFd) {
+				close(writeFd);
+			};
+		};
+		readFd = -1;
+		writeFd = -1;
+#endif
+		active = false;
+		client = false;
+		implicitFree.set(true);
+	};
+
+	bool isActive() {
+		return active;
+	};
+
+	bool isClient() {
+		return client;
+	};
+
+	String description() {
+		if (!active) {
+			return "off";
+		};
+		if (client) {
+			return String("client ") + auth;
+		};
+		return String("server ") + auth;
+	};
+
+	int acquire() {
+		if (!active) {
+			return noToken;
+		};
+		implicitLock.enter();
+		if (implicitFree.get()) {
+			implicitFree.set(false);
+			implicitLock.leave();
+			return implicitToken;
+		};
+		implicitLock.leave();
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		if (WaitForSingleObject(semaphore, INFINITE) != WAIT_OBJECT_0) {
+			return noToken;
+		};
+		return 0;
+#else
+		unsigned char token;
+		struct pollfd wait;
+		ssize_t size;
+		for (;;) {
+			size = read(readFd, &token, 1);
+			if (size == 1) {
+				return token;
+			};
+			if ((size < 0) && (errno == EINTR)) {
+				continue;
+			};
+			// make may set the shared pipe non-blocking
+			if ((size < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK))) {
+				wait.fd = readFd;
+				wait.events = POLLIN;
+				wait.revents = 0;
+				poll(&wait, 1, -1);
+				continue;
+			};
+			return noToken;
+		};
+#endif
+	};
+
+	void release(int token) {
+		if (token == noToken) {
+			return;
+		};
+		if (token == implicitToken) {
+			implicitFree.set(true);
+			return;
+		};
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		ReleaseSemaphore(semaphore, 1, nullptr);
+#else
+		unsigned char value = (unsigned char)token;
+		while (write(writeFd, &value, 1) < 0) {
+			if (errno != EINTR) {
+				break;
+			};
+		};
+#endif
+	};
+
+};
@@ -0,0 +1,33 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_JOBSERVER_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_JOBSERVER_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::JobServer {
+
+	// GNU make jobserver, the process owns one implicit job slot,
+	// every other running job holds a token read from the jobserver
+
+	// Join the jobserver of MAKEFLAGS --jobserver-auth (fifo:path, R,W pipe
+	// or a semaphore name on windows), if there is none serve jobs slots
+	// to child processes by MAKEFLAGS, for example to -flto=jobserver
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool start(int jobs);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void stop();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool isActive();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool isClient();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String description();
+	// Block until a job slot is free, the token is given back to release
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT int acquire();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void release(int token);
+
+};
+
+#endif
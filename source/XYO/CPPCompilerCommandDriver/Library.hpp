@@ -1,26 +1,82 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_LIBRARY_HPP
-#define XYO_CPPCOMPILERCOMMANDDRIVER_LIBRARY_HPP
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
-#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
-#endif
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILEROPTIONS_HPP
-#	include <XYO/CPPCompilerCommandDriver/CompilerOptions.hpp>
-#endif
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILERMSVC_HPP
-#	include <XYO/CPPCompilerCommandDriver/CompilerMSVC.hpp>
-#endif
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILERGCC_HPP
-#	include <XYO/CPPCompilerCommandDriver/CompilerGCC.hpp>
-#endif
-
-#endif
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_LIBRARY_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_LIBRARY_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILEROPTIONS_HPP
+#	include <XYO/CPPCompilerCommandDriver/CompilerOptions.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DIGEST_HPP
+#	include <XYO/CPPCompilerCommandDriver/Digest.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPFILE_HPP
+#	include <XYO/CPPCompilerCommandDriver/DepFile.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_FILESYSTEM_HPP
+#	include <XYO/CPPCompilerCommandDriver/FileSystem.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_UNITYBUILD_HPP
+#	include <XYO/CPPCompilerCommandDriver/UnityBuild.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_MODULEDEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/ModuleDependency.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILECACHE_HPP
+#	include <XYO/CPPCompilerCommandDriver/CompileCache.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_REMOTECACHE_HPP
+#	include <XYO/CPPCompilerCommandDriver/RemoteCache.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_CACHESERVER_HPP
+#	include <XYO/CPPCompilerCommandDriver/CacheServer.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_BUILDHISTORY_HPP
+#	include <XYO/CPPCompilerCommandDriver/BuildHistory.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_JOBSERVER_HPP
+#	include <XYO/CPPCompilerCommandDriver/JobServer.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_PROCESS_HPP
+#	include <XYO/CPPCompilerCommandDriver/Process.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_MEMORYBUDGET_HPP
+#	include <XYO/CPPCompilerCommandDriver/MemoryBudget.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_LOADLIMIT_HPP
+#	include <XYO/CPPCompilerCommandDriver/LoadLimit.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_BUILDTRACE_HPP
+#	include <XYO/CPPCompilerCommandDriver/BuildTrace.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILERMSVC_HPP
+#	include <XYO/CPPCompilerCommandDriver/CompilerMSVC.hpp>
+#endif
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_COMPILERGCC_HPP
+#	include <XYO/CPPCompilerCommandDriver/CompilerGCC.hpp>
+#endif
+
+#endif
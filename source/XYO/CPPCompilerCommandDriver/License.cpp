@@ -1,29 +1,29 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#include <XYO/CPPCompilerCommandDriver/License.hpp>
-#include <XYO/CPPCompilerCommandDriver/Copyright.hpp>
-
-namespace XYO::CPPCompilerCommandDriver::License {
-
-	std::string license() {
-		std::string retV;
-		retV += Platform::License::licenseMITHeader();
-		retV += Copyright::copyright();
-		retV += "\r\n";
-		retV += Platform::License::licenseMITContent();
-		return retV;
-	};
-
-	std::string shortLicense() {
-		std::string retV;
-		retV += Copyright::copyright();
-		retV += "\r\n";
-		retV += Platform::License::licenseMITShort();
-		return retV;
-	};
-
-};
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/License.hpp>
+#include <XYO/CPPCompilerCommandDriver/Copyright.hpp>
+
+namespace XYO::CPPCompilerCommandDriver::License {
+
+	std::string license() {
+		std::string retV;
+		retV += Platform::License::licenseMITHeader();
+		retV += Copyright::copyright();
+		retV += "\r\n";
+		retV += Platform::License::licenseMITContent();
+		return retV;
+	};
+
+	std::string shortLicense() {
+		std::string retV;
+		retV += Copyright::copyright();
+		retV += "\r\n";
+		retV += Platform::License::licenseMITShort();
+		return retV;
+	};
+
+};
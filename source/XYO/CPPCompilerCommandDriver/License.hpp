@@ -1,21 +1,21 @@
-// C++ Compiler Command Driver
-// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// MIT License (MIT) <http://opensource.org/licenses/MIT>
-// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
-// SPDX-License-Identifier: MIT
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_LICENSE_HPP
-#define XYO_CPPCOMPILERCOMMANDDRIVER_LICENSE_HPP
-
-#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
-#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
-#endif
-
-namespace XYO::CPPCompilerCommandDriver::License {
-
-	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT std::string license();
-	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT std::string shortLicense();
-
-};
-
-#endif
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_LICENSE_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_LICENSE_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::License {
+
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT std::string license();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT std::string shortLicense();
+
+};
+
+#endif
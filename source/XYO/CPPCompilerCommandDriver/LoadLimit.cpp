@@ -0,0 +1,124 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/LoadLimit.hpp>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace XYO::CPPCompilerCommandDriver::LoadLimit {
+
+	namespace LoadLimitX {
+
+		static CriticalSection lock;
+		static double maximum = 0;
+		static size_t running = 0;
+		static size_t delayed = 0;
+
+		static bool fits() {
+			double load;
+			if (running == 0) {
+				return true;
+			};
+			if (!getLoad(load)) {
+				return true;
+			};
+			return (load < maximum);
+		};
+
+	};
+
+	using namespace LoadLimitX;
+
+	bool getLoad(double &load) {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		return false;
+#else
+#	ifdef XYO_PLATFORM_OS_LINUX
+		// The one minute average lags behind the jobs just started,
+		// as make does use the processes runnable now, less this one
+		FILE *in;
+		int runnable;
+		int total;
+		in = fopen("/proc/loadavg", "rb");
+		if (in) {
+			if (fscanf(in, "%*f %*f %*f %d/%d", &runnable, &total) == 2) {
+				fclose(in);
+				load = (double)(runnable - 1);
+				return true;
+			};
+			fclose(in);
+		};
+#	endif
+		double average1;
+		if (getloadavg(&average1, 1) != 1) {
+			return false;
+		};
+		load = average1;
+		return true;
+#endif
+	};
+
+	bool setMaximum(double load) {
+		double current;
+		bool retV = true;
+		lock.enter();
+		maximum = 0;
+		delayed = 0;
+		if (load > 0) {
+			retV = getLoad(current);
+			if (retV) {
+				maximum = load;
+			};
+		};
+		lock.leave();
+		return retV;
+	};
+
+	bool isActive() {
+		bool retV;
+		lock.enter();
+		retV = (maximum > 0);
+		lock.leave();
+		return retV;
+	};
+
+	void admit() {
+		lock.enter();
+		if (maximum <= 0) {
+			lock.leave();
+			return;
+		};
+		if (!fits()) {
+			++delayed;
+			// The load changes without a release, poll it
+			while (!fits()) {
+				lock.leave();
+				Thread::sleep(250);
+				lock.enter();
+			};
+		};
+		++running;
+		lock.leave();
+	};
+
+	void release() {
+		lock.enter();
+		if (maximum > 0) {
+			--running;
+		};
+		lock.leave();
+	};
+
+	size_t getDelayed() {
+		size_t retV;
+		lock.enter();
+		retV = delayed;
+		lock.leave();
+		return retV;
+	};
+
+};
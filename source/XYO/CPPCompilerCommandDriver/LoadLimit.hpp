@@ -0,0 +1,30 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_LOADLIMIT_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_LOADLIMIT_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::LoadLimit {
+
+	// As make -l, no new compile job starts while the system load is
+	// above the maximum and another job runs
+
+	// 0 is no limit, false if the system load is unknown
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool setMaximum(double load);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool isActive();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool getLoad(double &load);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void admit();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void release();
+	// Jobs that waited for load since setMaximum
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT size_t getDelayed();
+
+};
+
+#endif
@@ -0,0 +1,97 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/MemoryBudget.hpp>
+#include <XYO/CPPCompilerCommandDriver/Process.hpp>
+
+namespace XYO::CPPCompilerCommandDriver::MemoryBudget {
+
+	namespace MemoryBudgetX {
+
+		static CriticalSection lock;
+		static uint64_t budget = 0;
+		static uint64_t reserved = 0;
+		static size_t running = 0;
+		static size_t delayed = 0;
+
+		static bool fits(uint64_t size) {
+			uint64_t available;
+			if (running == 0) {
+				return true;
+			};
+			if (reserved + size > budget) {
+				return false;
+			};
+			// Other processes may use memory the budget counted on
+			if (Process::getAvailableMemory(available)) {
+				if (size > available) {
+					return false;
+				};
+			};
+			return true;
+		};
+
+	};
+
+	using namespace MemoryBudgetX;
+
+	void setBudget(uint64_t size) {
+		lock.enter();
+		budget = size;
+		delayed = 0;
+		lock.leave();
+	};
+
+	uint64_t getBudget() {
+		uint64_t retV;
+		lock.enter();
+		retV = budget;
+		lock.leave();
+		return retV;
+	};
+
+	bool isActive() {
+		return (getBudget() > 0);
+	};
+
+	void admit(uint64_t size) {
+		lock.enter();
+		if (budget == 0) {
+			lock.leave();
+			return;
+		};
+		if (!fits(size)) {
+			++delayed;
+			// Available memory changes without a release, poll it
+			while (!fits(size)) {
+				lock.leave();
+				Thread::sleep(100);
+				lock.enter();
+			};
+		};
+		reserved += size;
+		++running;
+		lock.leave();
+	};
+
+	void release(uint64_t size) {
+		lock.enter();
+		if (budget > 0) {
+			reserved -= size;
+			--running;
+		};
+		lock.leave();
+	};
+
+	size_t getDelayed() {
+		size_t retV;
+		lock.enter();
+		retV = delayed;
+		lock.leave();
+		return retV;
+	};
+
+};
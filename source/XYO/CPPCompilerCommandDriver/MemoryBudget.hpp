@@ -0,0 +1,31 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_MEMORYBUDGET_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_MEMORYBUDGET_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::MemoryBudget {
+
+	// Compile jobs are admitted while their expected peak memory fits in
+	// the budget and in the memory available now, one job always runs
+
+	// Bytes, 0 admits jobs by thread count only
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void setBudget(uint64_t size);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT uint64_t getBudget();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool isActive();
+	// Block until the job fits, size is given back to release
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void admit(uint64_t size);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void release(uint64_t size);
+	// Jobs that waited for memory since setBudget
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT size_t getDelayed();
+
+};
+
+#endif
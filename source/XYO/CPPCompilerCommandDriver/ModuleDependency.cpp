@@ -0,0 +1,92 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/ModuleDependency.hpp>
+#include <XYO/FileJSON.hpp>
+
+namespace XYO::CPPCompilerCommandDriver::ModuleDependency {
+
+	namespace ModuleDependencyX {
+
+		static FileJSON::Value *getMember(FileJSON::VAssociativeArray *object, const char *name) {
+			size_t k;
+			for (k = 0; k < object->value->length(); ++k) {
+				if (object->value->arrayKey->index(k) == name) {
+					return object->value->arrayValue->index(k);
+				};
+			};
+			return nullptr;
+		};
+
+		// "provides" and "requires" of a rule are arrays of { "logical-name": ... }
+		static bool readNames(FileJSON::VAssociativeArray *rule, const char *name, TDynamicArray<String> &names) {
+			FileJSON::Value *item = getMember(rule, name);
+			FileJSON::VArray *vArray;
+			FileJSON::VAssociativeArray *vEntry;
+			FileJSON::VString *vString;
+			size_t k;
+
+			if (!item) {
+				return true;
+			};
+			vArray = TDynamicCast<FileJSON::VArray *>(item);
+			if (!vArray) {
+				return false;
+			};
+			for (k = 0; k < vArray->value->length(); ++k) {
+				vEntry = TDynamicCast<FileJSON::VAssociativeArray *>(vArray->value->index(k));
+				if (!vEntry) {
+					return false;
+				};
+				vString = TDynamicCast<FileJSON::VString *>(getMember(vEntry, "logical-name"));
+				if (!vString) {
+					return false;
+				};
+				names.push(vString->value);
+			};
+			return true;
+		};
+
+	};
+
+	using namespace ModuleDependencyX;
+
+	bool read(const String &fileName, TDynamicArray<String> &provided, TDynamicArray<String> &required) {
+		TPointer<FileJSON::Value> json;
+		FileJSON::VAssociativeArray *root;
+		FileJSON::VArray *rules;
+		FileJSON::VAssociativeArray *rule;
+		size_t k;
+
+		provided.empty();
+		required.empty();
+		if (!FileJSON::load(fileName, json)) {
+			return false;
+		};
+		root = TDynamicCast<FileJSON::VAssociativeArray *>(json);
+		if (!root) {
+			return false;
+		};
+		rules = TDynamicCast<FileJSON::VArray *>(getMember(root, "rules"));
+		if (!rules) {
+			return false;
+		};
+		for (k = 0; k < rules->value->length(); ++k) {
+			rule = TDynamicCast<FileJSON::VAssociativeArray *>(rules->value->index(k));
+			if (!rule) {
+				return false;
+			};
+			if (!readNames(rule, "provides", provided)) {
+				return false;
+			};
+			if (!readNames(rule, "requires", required)) {
+				return false;
+			};
+		};
+		return true;
+	};
+
+};
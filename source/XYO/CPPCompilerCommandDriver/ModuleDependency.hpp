@@ -0,0 +1,21 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_MODULEDEPENDENCY_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_MODULEDEPENDENCY_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::ModuleDependency {
+
+	// Read module names provided and required by a P1689 dependency file
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool read(const String &fileName, TDynamicArray<String> &provided, TDynamicArray<String> &required);
+
+};
+
+#endif
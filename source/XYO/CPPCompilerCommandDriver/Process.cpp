@@ -0,0 +1,715 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/Process.hpp>
+#include <XYO/CPPCompilerCommandDriver/FileSystem.hpp>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef XYO_PLATFORM_OS_WINDOWS
+#	include <windows.h>
+#else
+#	include <unistd.h>
+#	include <errno.h>
+#	include <signal.h>
+#	include <spawn.h>
+#	include <sys/types.h>
+#	include <sys/time.h>
+#	include <sys/resource.h>
+#	include <sys/wait.h>
+extern char **environ;
+#endif
+#ifdef XYO_PLATFORM_OS_LINUX
+#	include <sched.h>
+#	include <sys/syscall.h>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::Process {
+
+	namespace ProcessX {
+
+		// zero initialized, as clearUsage
+		static thread_local Usage threadUsage;
+		static thread_local Usage lastUsage;
+		static TAtomic<bool> stopped;
+		static TAtomic<uint64_t> timeout;
+
+		// Running commands, to terminate them on stop or on a signal
+		static const size_t maxRunning = 256;
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		static CriticalSection runningLock;
+		static HANDLE running[maxRunning];
+
+		static size_t addRunning(HANDLE job) {
+			size_t k;
+			runningLock.enter();
+			for (k = 0; k < maxRunning; ++k) {
+				if (!running[k]) {
+					running[k] = job;
+					break;
+				};
+			};
+			runningLock.leave();
+			return k;
+		};
+
+		static void removeRunning(size_t slot) {
+			runningLock.enter();
+			if (slot < maxRunning) {
+				running[slot] = nullptr;
+			};
+			runningLock.leave();
+		};
+
+		static void killRunning() {
+			size_t k;
+			runningLock.enter();
+			for (k = 0; k < maxRunning; ++k) {
+				if (running[k]) {
+					TerminateJobObject(running[k], 1);
+				};
+			};
+			runningLock.leave();
+		};
+#else
+		// Process groups, the signal handler reads them without the lock
+		static CriticalSection runningLock;
+		static TAtomic<pid_t> running[maxRunning];
+		static bool signalsInstalled = false;
+		static const int forwardSignal[3] = {SIGINT, SIGTERM, SIGHUP};
+
+		static size_t addRunning(pid_t group) {
+			size_t k;
+			runningLock.enter();
+			for (k = 0; k < maxRunning; ++k) {
+				if (running[k].get() == 0) {
+					running[k].set(group);
+					break;
+				};
+			};
+			runningLock.leave();
+			return k;
+		};
+
+		static void removeRunning(size_t slot) {
+			if (slot < maxRunning) {
+				running[slot].set(0);
+			};
+		};
+
+		static void killRunning(int signalNumber) {
+			size_t k;
+			pid_t group;
+			for (k = 0; k < maxRunning; ++k) {
+				group = running[k].get();
+				if (group > 0) {
+					kill(-group, signalNumber);
+				};
+			};
+		};
+
+		// Commands run in their own process group, out of reach of the
+		// terminal, pass them the interrupt and exit as by default
+		static void onSignal(int signalNumber) {
+			killRunning(signalNumber);
+			signal(signalNumber, SIG_DFL);
+			raise(signalNumber);
+		};
+
+		static void installSignals() {
+			struct sigaction action;
+			struct sigaction previous;
+			int k;
+			runningLock.enter();
+			if (signalsInstalled) {
+				runningLock.leave();
+				return;
+			};
+			signalsInstalled = true;
+			memset(&action, 0, sizeof(action));
+			action.sa_handler = onSignal;
+			sigemptyset(&action.sa_mask);
+			for (k = 0; k < 3; ++k) {
+				if (sigaction(forwardSignal[k], nullptr, &previous) == 0) {
+					if (previous.sa_handler == SIG_IGN) {
+						continue;
+					};
+				};
+				sigaction(forwardSignal[k], &action, nullptr);
+			};
+			runningLock.leave();
+		};
+#endif
+
+		static void addUsage(Usage &command) {
+			command.processes = 1;
+			lastUsage = command;
+			if (command.peakMemory > threadUsage.peakMemory) {
+				threadUsage.peakMemory = command.peakMemory;
+			};
+			threadUsage.userTime += command.userTime;
+			threadUsage.systemTime += command.systemTime;
+			threadUsage.readBytes += command.readBytes;
+			threadUsage.writtenBytes += command.writtenBytes;
+			++threadUsage.processes;
+			if (command.signal != 0) {
+				threadUsage.signal = command.signal;
+			};
+			if (command.timedOut) {
+				threadUsage.timedOut = true;
+			};
+			if (command.oomKilled) {
+				threadUsage.oomKilled = true;
+			};
+		};
+
+		// Processors of a list as "0-3,6", false on syntax error or
+		// a processor out of the affinity mask
+		static bool parseProcessorList(const String &list, TDynamicArray<int> &processors) {
+			const char *scan = list.value();
+			char *end;
+			long first;
+			long last;
+			long k;
+
+			processors.empty();
+			while (*scan) {
+				first = strtol(scan, &end, 10);
+				if ((end == scan) || (first < 0)) {
+					return false;
+				};
+				last = first;
+				scan = end;
+				if (*scan == '-') {
+					++scan;
+					last = strtol(scan, &end, 10);
+					if ((end == scan) || (last < first)) {
+						return false;
+					};
+					scan = end;
+				};
+				if (last >= getProcessorLimit()) {
+					return false;
+				};
+				for (k = first; k <= last; ++k) {
+					processors.push((int)k);
+				};
+				if (*scan == ',') {
+					++scan;
+					continue;
+				};
+				if (*scan) {
+					return false;
+				};
+			};
+			return !processors.isEmpty();
+		};
+
+#ifdef XYO_PLATFORM_OS_LINUX
+		static bool readLine(const String &fileName, String &line) {
+			FILE *in;
+			char buffer[4096];
+			in = fopen(fileName.value(), "rb");
+			if (!in) {
+				return false;
+			};
+			if (!fgets(buffer, sizeof(buffer), in)) {
+				fclose(in);
+				return false;
+			};
+			fclose(in);
+			line = String(buffer).trimASCII();
+			return true;
+		};
+
+		// Value of a "name value" line of a memory.stat file
+		static bool readStat(const String &fileName, const char *name, uint64_t &value) {
+			FILE *in;
+			char buffer[256];
+			size_t length = strlen(name);
+			bool retV = false;
+			in = fopen(fileName.value(), "rb");
+			if (!in) {
+				return false;
+			};
+			while (fgets(buffer, sizeof(buffer), in)) {
+				if ((strncmp(buffer, name, length) == 0) && (buffer[length] == ' ')) {
+					value = strtoull(&buffer[length + 1], nullptr, 10);
+					retV = true;
+					break;
+				};
+			};
+			fclose(in);
+			return retV;
+		};
+
+		// Folders of the cgroup v2 of the process, up to the root,
+		// a limit of any of them applies
+		static void cgroupFolders(TDynamicArray<String> &folders) {
+			FILE *in;
+			char buffer[4096];
+			String path;
+			size_t index;
+
+			folders.empty();
+			in = fopen("/proc/self/cgroup", "rb");
+			if (!in) {
+				return;
+			};
+			while (fgets(buffer, sizeof(buffer), in)) {
+				if (strncmp(buffer, "0::", 3) == 0) {
+					path = String(&buffer[3]).trimASCII();
+					break;
+				};
+			};
+			fclose(in);
+			if (path.isEmpty()) {
+				return;
+			};
+			for (;;) {
+				if ((path.length() > 1) && (path[path.length() - 1] == '/')) {
+					path = path.substring(0, path.length() - 1);
+				};
+				if (path == "/") {
+					folders.push("/sys/fs/cgroup");
+					break;
+				};
+				folders.push(String("/sys/fs/cgroup") + path);
+				index = path.length();
+				while ((index > 0) && (path[index - 1] != '/')) {
+					--index;
+				};
+				path = path.substring(0, index);
+			};
+		};
+#endif
+
+		// Kills by the oom killer in the cgroup of the process, or since
+		// boot without cgroup v2, other processes of it are counted too
+		static uint64_t oomKillCount() {
+#ifdef XYO_PLATFORM_OS_LINUX
+			TDynamicArray<String> folders;
+			uint64_t value;
+			cgroupFolders(folders);
+			if (folders.length() > 0) {
+				if (readStat(folders[0] + "/memory.events", "oom_kill", value)) {
+					return value;
+				};
+			};
+			if (readStat("/proc/vmstat", "oom_kill", value)) {
+				return value;
+			};
+#endif
+			return 0;
+		};
+
+#ifndef XYO_PLATFORM_OS_WINDOWS
+		// Killed as by the oom killer, a gcc driver reports a killed
+		// compiler proper as an internal error, exit code 4, not as a signal
+		static bool isKill(int exitCode, const Usage &command) {
+			if (command.timedOut) {
+				return false;
+			};
+			return (command.signal == SIGKILL) || (exitCode == 4);
+		};
+#endif
+
+	};
+
+	using namespace ProcessX;
+
+	int system(const String &cmd, bool timeLimit) {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		STARTUPINFOA startupInfo;
+		PROCESS_INFORMATION processInformation;
+		JOBOBJECT_EXTENDED_LIMIT_INFORMATION limitInformation;
+		JOBOBJECT_BASIC_AND_IO_ACCOUNTING_INFORMATION accountingInformation;
+		Usage command;
+		DWORD exitCode = 1;
+		HANDLE job;
+		size_t slot = maxRunning;
+		String commandLine = "cmd.exe /s /c \"" + cmd + "\"";
+
+		clearUsage(command);
+		clearUsage(lastUsage);
+		if (stopped.get()) {
+			return -1;
+		};
+		ZeroMemory(&startupInfo, sizeof(startupInfo));
+		startupInfo.cb = sizeof(startupInfo);
+		ZeroMemory(&processInformation, sizeof(processInformation));
+
+		// The job object accounts for the compiler started by cmd.exe
+		job = CreateJobObjectA(nullptr, nullptr);
+		if (!CreateProcessA(nullptr, (LPSTR)commandLine.value(), nullptr, nullptr, TRUE, CREATE_SUSPENDED, nullptr, nullptr, &startupInfo, &processInformation)) {
+			if (job) {
+				CloseHandle(job);
+			};
+			return -1;
+		};
+		if (job) {
+			AssignProcessToJobObject(job, processInformation.hProcess);
+			slot = addRunning(job);
+			if (stopped.get()) {
+				TerminateJobObject(job, 1);
+			};
+		};
+		ResumeThread(processInformation.hThread);
+		if (timeLimit && (timeout.get() > 0)) {
+			if (WaitForSingleObject(processInformation.hProcess, (DWORD)timeout.get()) == WAIT_TIMEOUT) {
+				command.timedOut = true;
+				if (job) {
+					TerminateJobObject(job, 1);
+				} else {
+					TerminateProcess(processInformation.hProcess, 1);
+				};
+			};
+		};
+		WaitForSingleObject(processInformation.hProcess, INFINITE);
+		GetExitCodeProcess(processInformation.hProcess, &exitCode);
+		removeRunning(slot);
+		if (job) {
+			if (QueryInformationJobObject(job, JobObjectExtendedLimitInformation, &limitInformation, sizeof(limitInformation), nullptr)) {
+				command.peakMemory = limitInformation.PeakProcessMemoryUsed;
+			};
+			if (QueryInformationJobObject(job, JobObjectBasicAndIoAccountingInformation, &accountingInformation, sizeof(accountingInformation), nullptr)) {
+				command.userTime = accountingInformation.BasicInfo.TotalUserTime.QuadPart / 10000;
+				command.systemTime = accountingInformation.BasicInfo.TotalKernelTime.QuadPart / 10000;
+				command.readBytes = accountingInformation.IoInfo.ReadTransferCount;
+				command.writtenBytes = accountingInformation.IoInfo.WriteTransferCount;
+			};
+			addUsage(command);
+			CloseHandle(job);
+		};
+		CloseHandle(processInformation.hThread);
+		CloseHandle(processInformation.hProcess);
+		return (int)exitCode;
+#else
+		const char *argv[4] = {"sh", "-c", cmd.value(), nullptr};
+		posix_spawnattr_t attributes;
+		struct rusage usage;
+		Usage command;
+		size_t slot;
+		pid_t pid;
+		pid_t waited;
+		int status;
+		int error;
+		int retV;
+		uint64_t oomKills;
+		uint64_t deadline = 0;
+		bool terminated = false;
+
+		clearUsage(command);
+		clearUsage(lastUsage);
+		if (stopped.get()) {
+			return -1;
+		};
+		oomKills = oomKillCount();
+		installSignals();
+		// A process group holds the shell, the compiler driver and
+		// the compiler proper, stop terminates all of them
+		posix_spawnattr_init(&attributes);
+		posix_spawnattr_setpgroup(&attributes, 0);
+		posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP);
+		error = posix_spawn(&pid, "/bin/sh", nullptr, &attributes, (char *const *)argv, environ);
+		posix_spawnattr_destroy(&attributes);
+		if (error != 0) {
+			return -1;
+		};
+		slot = addRunning(pid);
+		if (stopped.get()) {
+			kill(-pid, SIGTERM);
+		};
+		if (timeLimit && (timeout.get() > 0)) {
+			deadline = FileSystem::getMilliseconds() + timeout.get();
+		};
+		// Usage of the shell includes the compiler it waited for
+		for (;;) {
+			waited = wait4(pid, &status, (deadline > 0) ? WNOHANG : 0, &usage);
+			if (waited == pid) {
+				break;
+			};
+			if (waited < 0) {
+				if (errno == EINTR) {
+					continue;
+				};
+				removeRunning(slot);
+				return -1;
+			};
+			// Out of time, terminate, kill if it does not exit in 2 seconds
+			if (FileSystem::getMilliseconds() >= deadline) {
+				if (terminated) {
+					kill(-pid, SIGKILL);
+					deadline = 0;
+					continue;
+				};
+				command.timedOut = true;
+				terminated = true;
+				kill(-pid, SIGTERM);
+				deadline = FileSystem::getMilliseconds() + 2000;
+			};
+			Thread::sleep(10);
+		};
+		removeRunning(slot);
+		command.peakMemory = (uint64_t)usage.ru_maxrss * 1024;
+		command.userTime = (uint64_t)usage.ru_utime.tv_sec * 1000 + usage.ru_utime.tv_usec / 1000;
+		command.systemTime = (uint64_t)usage.ru_stime.tv_sec * 1000 + usage.ru_stime.tv_usec / 1000;
+		// Block operations are counted in 512 byte units, reads served
+		// by the page cache are not counted
+		command.readBytes = (uint64_t)usage.ru_inblock * 512;
+		command.writtenBytes = (uint64_t)usage.ru_oublock * 512;
+		retV = -1;
+		if (WIFEXITED(status)) {
+			retV = WEXITSTATUS(status);
+			// The shell reports a command killed by a signal as 128 + signal
+			if ((retV > 128) && (retV < 128 + 65)) {
+				command.signal = retV - 128;
+			};
+		};
+		if (WIFSIGNALED(status)) {
+			retV = 128 + WTERMSIG(status);
+			command.signal = WTERMSIG(status);
+		};
+		if (isKill(retV, command)) {
+			if (oomKillCount() > oomKills) {
+				command.oomKilled = true;
+			};
+		};
+		addUsage(command);
+		return retV;
+#endif
+	};
+
+	void stop(bool terminate) {
+		stopped.set(true);
+		if (terminate) {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+			killRunning();
+#else
+			killRunning(SIGTERM);
+#endif
+		};
+	};
+
+	bool isStopped() {
+		return stopped.get();
+	};
+
+	void resume() {
+		stopped.set(false);
+	};
+
+	void setTimeout(uint64_t milliseconds) {
+		timeout.set(milliseconds);
+	};
+
+	bool setBackground() {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		// Below normal, unlike background mode, is inherited by child processes
+		return (SetPriorityClass(GetCurrentProcess(), BELOW_NORMAL_PRIORITY_CLASS) != 0);
+#else
+		bool retV = (setpriority(PRIO_PROCESS, 0, 19) == 0);
+#	if defined(XYO_PLATFORM_OS_LINUX) && defined(SYS_ioprio_set)
+		// IOPRIO_WHO_PROCESS, IOPRIO_CLASS_IDLE
+		if (syscall(SYS_ioprio_set, 1, 0, 3 << 13) != 0) {
+			retV = false;
+		};
+#	endif
+		return retV;
+#endif
+	};
+
+	int getProcessorLimit() {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		return (int)(sizeof(DWORD_PTR) * 8);
+#elif defined(XYO_PLATFORM_OS_LINUX)
+		return CPU_SETSIZE;
+#else
+		return 0;
+#endif
+	};
+
+	bool setProcessorSet(const String &list) {
+		TDynamicArray<int> processors;
+
+		if (!parseProcessorList(list, processors)) {
+			return false;
+		};
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		DWORD_PTR mask = 0;
+		size_t k;
+		for (k = 0; k < processors.length(); ++k) {
+			mask |= ((DWORD_PTR)1) << processors[k];
+		};
+		return (SetProcessAffinityMask(GetCurrentProcess(), mask) != 0);
+#elif defined(XYO_PLATFORM_OS_LINUX)
+		cpu_set_t set;
+		size_t k;
+		CPU_ZERO(&set);
+		for (k = 0; k < processors.length(); ++k) {
+			CPU_SET(processors[k], &set);
+		};
+		return (sched_setaffinity(0, sizeof(set), &set) == 0);
+#else
+		return false;
+#endif
+	};
+
+	void clearUsage(Usage &usage) {
+		usage.peakMemory = 0;
+		usage.userTime = 0;
+		usage.systemTime = 0;
+		usage.readBytes = 0;
+		usage.writtenBytes = 0;
+		usage.processes = 0;
+		usage.signal = 0;
+		usage.timedOut = false;
+		usage.oomKilled = false;
+	};
+
+	void resetUsage() {
+		clearUsage(threadUsage);
+	};
+
+	void getUsage(Usage &usage) {
+		usage = threadUsage;
+	};
+
+	void getLastUsage(Usage &usage) {
+		usage = lastUsage;
+	};
+
+	bool getAvailableMemory(uint64_t &size) {
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		MEMORYSTATUSEX status;
+		status.dwLength = sizeof(status);
+		if (!GlobalMemoryStatusEx(&status)) {
+			return false;
+		};
+		size = status.ullAvailPhys;
+		return true;
+#else
+		FILE *in;
+		char line[256];
+		unsigned long long value;
+		uint64_t limited;
+		bool isLimited = getLimitedMemory(limited);
+		bool retV = false;
+
+		in = fopen("/proc/meminfo", "rb");
+		if (in) {
+			while (fgets(line, sizeof(line), in)) {
+				if (sscanf(line, "MemAvailable: %llu kB", &value) == 1) {
+					size = (uint64_t)value * 1024;
+					retV = true;
+					break;
+				};
+			};
+			fclose(in);
+		};
+		if (isLimited) {
+			if ((!retV) || (limited < size)) {
+				size = limited;
+			};
+			return true;
+		};
+		return retV;
+#endif
+	};
+
+	bool getLimitedMemory(uint64_t &size) {
+#ifdef XYO_PLATFORM_OS_LINUX
+		TDynamicArray<String> folders;
+		String maximum;
+		String current;
+		uint64_t available;
+		uint64_t used;
+		uint64_t reclaimable;
+		bool retV = false;
+		size_t k;
+
+		cgroupFolders(folders);
+		for (k = 0; k < folders.length(); ++k) {
+			if (!readLine(folders[k] + "/memory.max", maximum)) {
+				continue;
+			};
+			if (maximum == "max") {
+				continue;
+			};
+			available = strtoull(maximum.value(), nullptr, 10);
+			if (readLine(folders[k] + "/memory.current", current)) {
+				used = strtoull(current.value(), nullptr, 10);
+				// memory.current counts the page cache, as of the sources
+				// just read, the inactive part is reclaimed before any oom
+				if (readStat(folders[k] + "/memory.stat", "inactive_file", reclaimable)) {
+					used = (reclaimable < used) ? (used - reclaimable) : 0;
+				};
+				available = (used < available) ? (available - used) : 0;
+			};
+			if ((!retV) || (available < size)) {
+				size = available;
+				retV = true;
+			};
+		};
+		return retV;
+#else
+		return false;
+#endif
+	};
+
+	int getProcessorCount(String &decision) {
+		int retV = Processor::getCount();
+		char buffer[256];
+
+		snprintf(buffer, sizeof(buffer), "%d processors", retV);
+		decision = buffer;
+#ifdef XYO_PLATFORM_OS_LINUX
+		TDynamicArray<String> folders;
+		String quota;
+		cpu_set_t set;
+		unsigned long long maximum;
+		unsigned long long period;
+		int count;
+		size_t k;
+
+		if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+			count = CPU_COUNT(&set);
+			snprintf(buffer, sizeof(buffer), ", affinity %d", count);
+			decision << buffer;
+			if ((count > 0) && (count < retV)) {
+				retV = count;
+			};
+		};
+
+		cgroupFolders(folders);
+		for (k = 0; k < folders.length(); ++k) {
+			if (!readLine(folders[k] + "/cpu.max", quota)) {
+				continue;
+			};
+			// "max 100000" is no quota
+			if (sscanf(quota.value(), "%llu %llu", &maximum, &period) != 2) {
+				continue;
+			};
+			if (period == 0) {
+				continue;
+			};
+			// A partial processor still runs a job
+			count = (int)((maximum + period - 1) / period);
+			snprintf(buffer, sizeof(buffer), ", cgroup quota %d (%s)", count, folders[k].value());
+			decision << buffer;
+			if ((count > 0) && (count < retV)) {
+				retV = count;
+			};
+		};
+#endif
+		if (retV < 1) {
+			retV = 1;
+		};
+		return retV;
+	};
+
+};
@@ -0,0 +1,74 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_PROCESS_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_PROCESS_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::Process {
+
+	// Resources used by the commands of the calling thread
+	struct Usage {
+			// largest resident set of a process, bytes
+			uint64_t peakMemory;
+			// milliseconds
+			uint64_t userTime;
+			uint64_t systemTime;
+			// storage io, bytes
+			uint64_t readBytes;
+			uint64_t writtenBytes;
+			uint64_t processes;
+			// signal that terminated the last command killed, 0 for none
+			int signal;
+			// a command ran out of time and was terminated
+			bool timedOut;
+			// a command was killed, or its compiler reported killed, while
+			// the oom killer ran in the cgroup of the process
+			bool oomKilled;
+	};
+
+	// Run command by the shell, as Shell::system, and add the resources
+	// used by it and its child processes to the usage of the calling thread,
+	// with timeLimit the command is terminated at the timeout
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT int system(const String &cmd, bool timeLimit);
+	// Commands do not start until resume, system returns -1,
+	// terminate also kills the running ones
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void stop(bool terminate);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool isStopped();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void resume();
+	// Wall clock limit of each command in milliseconds, 0 for none
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void setTimeout(uint64_t milliseconds);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void clearUsage(Usage &usage);
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void resetUsage();
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void getUsage(Usage &usage);
+	// Resources of the last command of the calling thread alone
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT void getLastUsage(Usage &usage);
+
+	// Lower cpu and io priority of this process, inherited by its threads
+	// and the commands they run, call before starting threads
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool setBackground();
+	// Processors of setProcessorSet are below the limit of the affinity mask
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT int getProcessorLimit();
+	// Run this process and its commands only on the processors of list,
+	// for example "0-3,6"
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool setProcessorSet(const String &list);
+
+	// Memory new processes can use without swapping, within the cgroup
+	// memory limit, false if unknown
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool getAvailableMemory(uint64_t &size);
+	// Cgroup v2 memory.max less memory.current without the inactive page
+	// cache of memory.stat, false without a limit
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool getLimitedMemory(uint64_t &size);
+	// Processors this process may run on, by affinity mask and cgroup v2
+	// cpu.max quota, decision tells the limits found
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT int getProcessorCount(String &decision);
+
+};
+
+#endif
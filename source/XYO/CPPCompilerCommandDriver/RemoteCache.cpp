@@ -0,0 +1,223 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/RemoteCache.hpp>
+#include <XYO/CPPCompilerCommandDriver/CompileCache.hpp>
+#include <XYO/CPPCompilerCommandDriver/Digest.hpp>
+#include <XYO/CPPCompilerCommandDriver/FileSystem.hpp>
+
+#include <stdio.h>
+
+namespace XYO::CPPCompilerCommandDriver::RemoteCache {
+
+	namespace RemoteCacheX {
+
+		// Counters and flags are shared by the compile threads
+		static CriticalSection lock;
+		static TAtomic<uint64_t> hits;
+		static TAtomic<uint64_t> misses;
+		static TAtomic<uint64_t> uploads;
+		// Set at the first failed connection, each request would
+		// otherwise wait for the connect timeout
+		static TAtomic<bool> unreachable;
+
+		static void count(TAtomic<uint64_t> &counter) {
+			lock.enter();
+			counter.set(counter.get() + 1);
+			lock.leave();
+		};
+
+		// True only for the call that set it
+		static bool setUnreachable() {
+			bool retV;
+			lock.enter();
+			retV = !unreachable.get();
+			unreachable.set(true);
+			lock.leave();
+			return retV;
+		};
+
+		// Entry files, diagnostics before object like in the local cache
+		static const char *entryExtension[] = {"txt", "o"};
+		static const size_t entryExtensionCount = 2;
+
+		static String curlCommand() {
+			String curl = Shell::getEnv("CURL");
+			if (curl.length() == 0) {
+				curl = "curl";
+			};
+			return curl;
+		};
+
+	};
+
+	using namespace RemoteCacheX;
+
+	bool httpGet(const String &url, const String &fileName) {
+		String cmd = curlCommand();
+		String statusFile = fileName + ".status";
+		String status;
+
+		if (unreachable.get()) {
+			return false;
+		};
+		// Status 000 is no response, the server is down or unreachable
+		cmd << " -s --connect-timeout 5 -o \"" << fileName << "\" -w \"%{http_code}\" \"" << url << "\" >\"" << statusFile << "\"";
+		Shell::system(cmd);
+		Shell::fileGetContents(statusFile, status);
+		Shell::remove(statusFile);
+		if (status == "200") {
+			return true;
+		};
+		Shell::remove(fileName);
+		if (status.isEmpty() || status == "000") {
+			if (setUnreachable()) {
+				printf("[remote-cache] no response from %s, remote cache disabled for this build\n", url.value());
+			};
+		};
+		return false;
+	};
+
+	bool fetch(const String &url, const String &cachePath, const String &key) {
+		String entry = CompileCache::entryPath(cachePath, key);
+		String acFile;
+		String content;
+		TDynamicArray<String> lines;
+		TDynamicArray<String> blobFile;
+		TDynamicArray<String> blobExtension;
+		String digest;
+		size_t k;
+		size_t m;
+		size_t index;
+
+		if (Shell::fileExists(entry + ".o")) {
+			return true;
+		};
+		if (unreachable.get()) {
+			return false;
+		};
+		if (!Shell::mkdirFilePath(entry)) {
+			return false;
+		};
+
+		acFile = CompileCache::tmpFileName(entry + ".ac");
+		if (!httpGet(url + "/ac/" + key, acFile)) {
+			count(misses);
+			return false;
+		};
+		if (!Shell::fileGetContents(acFile, content)) {
+			Shell::remove(acFile);
+			count(misses);
+			return false;
+		};
+		content.replace("\r", "").explode("\n", lines);
+
+		for (m = 0; m < entryExtensionCount; ++m) {
+			for (k = 0; k < lines.length(); ++k) {
+				if (!lines[k].indexOf(" ", 0, index)) {
+					continue;
+				};
+				if (lines[k].substring(0, index) != entryExtension[m]) {
+					continue;
+				};
+				String blobDigest = lines[k].substring(index + 1);
+				String tmpFile = CompileCache::tmpFileName(entry + "." + entryExtension[m]);
+				if (httpGet(url + "/cas/" + blobDigest, tmpFile)) {
+					if (Digest::sha256File(tmpFile, digest)) {
+						if (digest == blobDigest) {
+							blobFile.push(tmpFile);
+							blobExtension.push(entryExtension[m]);
+							break;
+						};
+					};
+				};
+				Shell::remove(tmpFile);
+				break;
+			};
+		};
+
+		if (blobFile.length() != entryExtensionCount) {
+			for (k = 0; k < blobFile.length(); ++k) {
+				Shell::remove(blobFile[k]);
+			};
+			Shell::remove(acFile);
+			count(misses);
+			return false;
+		};
+
+		for (k = 0; k < blobFile.length(); ++k) {
+			FileSystem::setReadOnly(blobFile[k]);
+			if (!CompileCache::publish(blobFile[k], entry + "." + blobExtension[k])) {
+				Shell::remove(acFile);
+				count(misses);
+				return false;
+			};
+		};
+		CompileCache::publish(acFile, entry + ".ac");
+		count(hits);
+		return true;
+	};
+
+	bool upload(const String &url, const String &cachePath, const String &key) {
+		String entry = CompileCache::entryPath(cachePath, key);
+		String curl = curlCommand();
+		String content;
+		String digest;
+		String cmd;
+		String tmpFile;
+		size_t m;
+
+		if (unreachable.get()) {
+			return false;
+		};
+		for (m = 0; m < entryExtensionCount; ++m) {
+			String fileName = entry + "." + entryExtension[m];
+			if (!Digest::sha256File(fileName, digest)) {
+				return false;
+			};
+			content << entryExtension[m] << " " << digest << "\n";
+			if (!cmd.isEmpty()) {
+				cmd << " && ";
+			};
+			cmd << curl << " -sf --connect-timeout 5 -T \"" << fileName << "\" \"" << url << "/cas/" << digest << "\"";
+		};
+
+		tmpFile = CompileCache::tmpFileName(entry + ".ac");
+		if (!Shell::filePutContents(tmpFile, content)) {
+			Shell::remove(tmpFile);
+			return false;
+		};
+		if (!CompileCache::publish(tmpFile, entry + ".ac")) {
+			return false;
+		};
+		// Action entry last, readers never see it before its blobs
+		cmd << " && " << curl << " -sf --connect-timeout 5 -T \"" << entry << ".ac\" \"" << url << "/ac/" << key << "\"";
+
+		String background;
+#ifdef XYO_PLATFORM_OS_WINDOWS
+		background = "start \"\" /b cmd /c \"";
+		background << cmd << "\" >NUL 2>&1";
+#else
+		background = "(";
+		background << cmd << ") >/dev/null 2>&1 &";
+#endif
+		if (Shell::system(background) != 0) {
+			return false;
+		};
+		count(uploads);
+		return true;
+	};
+
+	String statistics() {
+		char buffer[256];
+		snprintf(buffer, sizeof(buffer), "remote hits %llu, misses %llu, uploads %llu",
+		         (unsigned long long)hits.get(),
+		         (unsigned long long)misses.get(),
+		         (unsigned long long)uploads.get());
+		return buffer;
+	};
+
+};
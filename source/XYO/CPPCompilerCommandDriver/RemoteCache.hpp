@@ -0,0 +1,31 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_REMOTECACHE_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_REMOTECACHE_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver::RemoteCache {
+
+	// HTTP cache with bazel-remote layout, url/ac/<key> lists the
+	// url/cas/<sha256> blobs of an entry, transfers are done by curl
+
+	// After a request gets no response the remote cache is not used
+	// again by this process
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool httpGet(const String &url, const String &fileName);
+	// Download entry key into the local cache, if not already there
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool fetch(const String &url, const String &cachePath, const String &key);
+	// Upload entry key of the local cache in background
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool upload(const String &url, const String &cachePath, const String &key);
+
+	XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT String statistics();
+
+};
+
+#endif
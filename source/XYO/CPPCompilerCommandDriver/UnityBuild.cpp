@@ -0,0 +1,651 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#include <XYO/CPPCompilerCommandDriver/UnityBuild.hpp>
+#include <XYO/CPPCompilerCommandDriver/FileSystem.hpp>
+#include <XYO/CPPCompilerCommandDriver/BuildHistory.hpp>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace XYO::CPPCompilerCommandDriver {
+
+	namespace UnityBuildX {
+
+		struct Source {
+				String fileName;
+				uint64_t size;
+				size_t order;
+				int batch;
+				int64_t lastWriteTime;
+				bool detached;
+		};
+
+		struct Entry {
+				int batch;
+				int64_t lastWriteTime;
+				bool detached;
+		};
+
+		struct Batch {
+				uint64_t size;
+				size_t count;
+		};
+
+		typedef TDynamicArray<int> IncludeList;
+
+		static bool readManifest(const String &fileName, size_t &batchSize, String &mode, TAssociativeArray<String, Entry> &assignment) {
+			String content;
+			TDynamicArray<String> lines;
+			TDynamicArray<String> fields;
+			Entry entry;
+			size_t k;
+
+			if (!Shell::fileGetContents(fileName, content)) {
+				return false;
+			};
+			content.replace("\r", "").explode("\n", lines);
+			if (lines.length() < 1) {
+				return false;
+			};
+			batchSize = (size_t)atol(lines[0].value());
+			mode = "size";
+			if (lines[0].indexOf(" ", 0, k)) {
+				mode = lines[0].substring(k + 1);
+			};
+			for (k = 1; k < lines.length(); ++k) {
+				fields.empty();
+				lines[k].explode("\t", fields);
+				if (fields.length() != 4) {
+					continue;
+				};
+				entry.batch = atoi(fields[0].value());
+				entry.lastWriteTime = (int64_t)atoll(fields[1].value());
+				entry.detached = (fields[2] == "1");
+				assignment.set(fields[3], entry);
+			};
+			return true;
+		};
+
+		static void addBatch(TDynamicArray<Batch> &batches) {
+			Batch batch;
+			batch.size = 0;
+			batch.count = 0;
+			batches.push(batch);
+		};
+
+		static void assignBatch(Source &source, TDynamicArray<Batch> &batches, size_t batchSize) {
+			size_t k;
+			int selected = -1;
+			for (k = 0; k < batches.length(); ++k) {
+				if (batches[k].count >= batchSize) {
+					continue;
+				};
+				if (selected < 0) {
+					selected = (int)k;
+					continue;
+				};
+				if (batches[k].size < batches[selected].size) {
+					selected = (int)k;
+				};
+			};
+			if (selected < 0) {
+				addBatch(batches);
+				selected = (int)batches.length() - 1;
+			};
+			source.batch = selected;
+			batches[selected].size += source.size;
+			batches[selected].count++;
+		};
+
+		// Sources by descending size, equal sizes keep list order
+		static void largestFirst(TDynamicArray<Source> &sources, TDynamicArray<size_t> &pending) {
+			TDynamicArray<uint64_t> size;
+			TDynamicArray<size_t> order;
+			TDynamicArray<size_t> list;
+			size_t k;
+			for (k = 0; k < pending.length(); ++k) {
+				size[k] = sources[pending[k]].size;
+				list[k] = pending[k];
+			};
+			BuildHistory::longestFirst(size, order);
+			for (k = 0; k < order.length(); ++k) {
+				pending[k] = list[order[k]];
+			};
+		};
+
+		static void setFlags(TDynamicArray<bool> &flags, size_t length) {
+			size_t k;
+			for (k = flags.length(); k < length; ++k) {
+				flags[k] = false;
+			};
+		};
+
+		// Includes not found on the include path are system headers, weight them
+		static const uint64_t unresolvedIncludeSize = 64 * 1024;
+
+		class IncludeScan {
+			public:
+				TDynamicArray<String> incPath;
+				TDynamicArray<String> headerName;
+				TDynamicArray<uint64_t> headerSize;
+				TDynamicArray<bool> headerResolved;
+				TDynamicArray<bool> headerScanned;
+				TDynamicArray<TPointer<IncludeList>> headerInclude;
+				TAssociativeArray<String, int> headerIndex;
+
+				int addHeader(const String &name, uint64_t size, bool resolved) {
+					int index;
+					if (headerIndex.get(name, index)) {
+						return index;
+					};
+					index = (int)headerName.length();
+					headerIndex.set(name, index);
+					headerName.push(name);
+					headerSize.push(size);
+					headerResolved.push(resolved);
+					headerScanned.push(false);
+					headerInclude.push(TMemory<IncludeList>::newMemory());
+					return index;
+				};
+
+				int resolve(const String &from, const String &name, bool isQuoted) {
+					TDynamicArray<String> candidate;
+					uint64_t size;
+					size_t k;
+					if (isQuoted) {
+						String path = from.replace("\\", "/");
+						size_t index = 0;
+						size_t next;
+						while (path.indexOf("/", index, next)) {
+							index = next + 1;
+						};
+						candidate.push(path.substring(0, index) + name);
+					};
+					for (k = 0; k < incPath.length(); ++k) {
+						candidate.push(incPath[k] + "/" + name);
+					};
+					for (k = 0; k < candidate.length(); ++k) {
+						if (FileSystem::getFileSize(candidate[k], size)) {
+							return addHeader(candidate[k], size, true);
+						};
+					};
+					return addHeader("<" + name + ">", unresolvedIncludeSize, false);
+				};
+
+				// Only #include lines are looked at, conditionals are ignored
+				void scanFile(const String &fileName, IncludeList &directInclude) {
+					String content;
+					const char *line;
+					const char *stop;
+					char close;
+					directInclude.empty();
+					if (!Shell::fileGetContents(fileName, content)) {
+						return;
+					};
+					for (line = content.value(); *line; ++line) {
+						while (*line == ' ' || *line == '\t') {
+							++line;
+						};
+						if (*line == '#') {
+							++line;
+							while (*line == ' ' || *line == '\t') {
+								++line;
+							};
+							if (StringCore::beginWith(line, "include")) {
+								line += 7;
+								while (*line == ' ' || *line == '\t') {
+									++line;
+								};
+								if (*line == '"' || *line == '<') {
+									close = (*line == '"') ? '"' : '>';
+									++line;
+									for (stop = line; *stop && *stop != close && *stop != '\n'; ++stop) {
+									};
+									if (*stop == close) {
+										directInclude.push(resolve(fileName, content.substring(line - content.value(), stop - line), close == '"'));
+									};
+								};
+							};
+						};
+						while (*line && *line != '\n') {
+							++line;
+						};
+						if (!*line) {
+							break;
+						};
+					};
+				};
+
+				void closure(const String &fileName, IncludeList &include) {
+					IncludeList stack;
+					IncludeList directInclude;
+					TDynamicArray<bool> visited;
+					size_t stackLength = 0;
+					size_t k;
+					int index;
+					include.empty();
+					scanFile(fileName, directInclude);
+					for (k = 0; k < directInclude.length(); ++k) {
+						stack[stackLength++] = directInclude[k];
+					};
+					while (stackLength > 0) {
+						index = stack[--stackLength];
+						setFlags(visited, headerName.length());
+						if (visited[index]) {
+							continue;
+						};
+						visited[index] = true;
+						include.push(index);
+						if (headerResolved[index] && !headerScanned[index]) {
+							headerScanned[index] = true;
+							scanFile(headerName[index], *headerInclude[index]);
+						};
+						IncludeList &headerIncludeList = *headerInclude[index];
+						for (k = 0; k < headerIncludeList.length(); ++k) {
+							stack[stackLength++] = headerIncludeList[k];
+						};
+					};
+				};
+		};
+
+		static uint64_t includeBytes(IncludeList &include, TDynamicArray<uint64_t> &headerSize) {
+			uint64_t retV = 0;
+			size_t k;
+			for (k = 0; k < include.length(); ++k) {
+				retV += headerSize[include[k]];
+			};
+			return retV;
+		};
+
+		// Estimate of bytes the compiler parses for a batch assignment
+		static uint64_t parsedBytes(TDynamicArray<Source> &sources, TDynamicArray<TPointer<IncludeList>> &include, TDynamicArray<uint64_t> &headerSize) {
+			TDynamicArray<TPointer<TDynamicArray<bool>>> batchHeader;
+			uint64_t retV = 0;
+			size_t k;
+			size_t m;
+			int header;
+			for (k = 0; k < sources.length(); ++k) {
+				retV += sources[k].size;
+				if (sources[k].batch < 0) {
+					retV += includeBytes(*include[k], headerSize);
+					continue;
+				};
+				TPointer<TDynamicArray<bool>> &marked = batchHeader[sources[k].batch];
+				if (!marked) {
+					marked = TMemory<TDynamicArray<bool>>::newMemory();
+					setFlags(*marked, headerSize.length());
+				};
+				for (m = 0; m < include[k]->length(); ++m) {
+					header = include[k]->index(m);
+					if (!marked->index(header)) {
+						marked->index(header) = true;
+						retV += headerSize[header];
+					};
+				};
+			};
+			return retV;
+		};
+
+		// Seed a batch with the heaviest source, then add the sources
+		// sharing the most include bytes with the batch so far
+		static void clusterByInclude(TDynamicArray<Source> &sources, TDynamicArray<size_t> &pending, TDynamicArray<TPointer<IncludeList>> &include, TDynamicArray<uint64_t> &headerSize, TDynamicArray<Batch> &batches, size_t batchSize) {
+			TDynamicArray<TPointer<TDynamicArray<size_t>>> headerUser;
+			TDynamicArray<uint64_t> gain;
+			TDynamicArray<bool> assigned;
+			TDynamicArray<bool> marked;
+			IncludeList markedList;
+			TDynamicArray<uint64_t> weight;
+			TDynamicArray<size_t> order;
+			TDynamicArray<size_t> list;
+			size_t left = pending.length();
+			size_t next = 0;
+			size_t k;
+			size_t m;
+			int index;
+
+			for (k = 0; k < headerSize.length(); ++k) {
+				headerUser[k] = TMemory<TDynamicArray<size_t>>::newMemory();
+			};
+			for (k = 0; k < sources.length(); ++k) {
+				gain[k] = 0;
+			};
+			setFlags(assigned, sources.length());
+			setFlags(marked, headerSize.length());
+			for (k = 0; k < pending.length(); ++k) {
+				for (m = 0; m < include[pending[k]]->length(); ++m) {
+					headerUser[include[pending[k]]->index(m)]->push(pending[k]);
+				};
+				weight[k] = sources[pending[k]].size + includeBytes(*include[pending[k]], headerSize);
+				list[k] = pending[k];
+			};
+			BuildHistory::longestFirst(weight, order);
+			for (k = 0; k < order.length(); ++k) {
+				pending[k] = list[order[k]];
+			};
+
+			while (left > 0) {
+				while (assigned[pending[next]]) {
+					++next;
+				};
+				addBatch(batches);
+				int current = (int)batches.length() - 1;
+				size_t selected = pending[next];
+				for (;;) {
+					assigned[selected] = true;
+					--left;
+					sources[selected].batch = current;
+					batches[current].size += sources[selected].size;
+					batches[current].count++;
+					for (m = 0; m < include[selected]->length(); ++m) {
+						index = include[selected]->index(m);
+						if (marked[index]) {
+							continue;
+						};
+						marked[index] = true;
+						markedList.push(index);
+						for (k = 0; k < headerUser[index]->length(); ++k) {
+							gain[headerUser[index]->index(k)] += headerSize[index];
+						};
+					};
+					if (left == 0 || batches[current].count >= batchSize) {
+						break;
+					};
+					bool found = false;
+					for (k = next; k < pending.length(); ++k) {
+						if (assigned[pending[k]]) {
+							continue;
+						};
+						if (!found || gain[pending[k]] > gain[selected]) {
+							selected = pending[k];
+							found = true;
+						};
+					};
+				};
+				for (m = 0; m < markedList.length(); ++m) {
+					marked[markedList[m]] = false;
+					for (k = 0; k < headerUser[markedList[m]]->length(); ++k) {
+						gain[headerUser[markedList[m]]->index(k)] = 0;
+					};
+				};
+				markedList.empty();
+			};
+		};
+
+		static void assignBatchByInclude(size_t index, TDynamicArray<Source> &sources, TDynamicArray<TPointer<IncludeList>> &include, TDynamicArray<uint64_t> &headerSize, TDynamicArray<Batch> &batches, size_t batchSize) {
+			TDynamicArray<uint64_t> shared;
+			TDynamicArray<bool> member;
+			TDynamicArray<bool> counted;
+			int selected = -1;
+			int header;
+			size_t k;
+			size_t m;
+			size_t n;
+			setFlags(member, headerSize.length());
+			for (m = 0; m < include[index]->length(); ++m) {
+				member[include[index]->index(m)] = true;
+			};
+			for (m = 0; m < batches.length(); ++m) {
+				shared[m] = 0;
+				if (batches[m].count >= batchSize) {
+					continue;
+				};
+				counted.empty();
+				setFlags(counted, headerSize.length());
+				for (k = 0; k < sources.length(); ++k) {
+					if (sources[k].batch != (int)m) {
+						continue;
+					};
+					for (n = 0; n < include[k]->length(); ++n) {
+						header = include[k]->index(n);
+						if (member[header] && !counted[header]) {
+							counted[header] = true;
+							shared[m] += headerSize[header];
+						};
+					};
+				};
+				if (selected < 0 || shared[m] > shared[selected]) {
+					selected = (int)m;
+				};
+			};
+			if (selected < 0) {
+				assignBatch(sources[index], batches, batchSize);
+				return;
+			};
+			sources[index].batch = selected;
+			batches[selected].size += sources[index].size;
+			batches[selected].count++;
+		};
+
+	};
+
+	using namespace UnityBuildX;
+
+	UnityBuild::UnityBuild() {
+		batchSize = 8;
+		stableTime = 300;
+		mode = "size";
+		echoCmd = false;
+	};
+
+	bool UnityBuild::generate(TDynamicArray<String> &srcFiles, TDynamicArray<String> &unityFiles) {
+		String unityPath = tmpPath + "/" + projectName + ".unity";
+		String manifestFile = unityPath + "/manifest.txt";
+		TDynamicArray<Source> sources;
+		TDynamicArray<Batch> batches;
+		TAssociativeArray<String, Entry> assignment;
+		Entry entry;
+		size_t storedBatchSize = 0;
+		String storedMode;
+		bool isIncludeMode = (mode == "include");
+		IncludeScan includeScan;
+		TDynamicArray<TPointer<IncludeList>> include;
+		TDynamicArray<size_t> pending;
+		bool hasManifest;
+		int64_t now = FileSystem::getTime();
+		size_t numberOfDetached = 0;
+		size_t k;
+		size_t m;
+
+		unityFiles.empty();
+		if (batchSize < 2 || srcFiles.length() < 2) {
+			for (k = 0; k < srcFiles.length(); ++k) {
+				unityFiles.push(srcFiles[k]);
+			};
+			return true;
+		};
+
+		if (!Shell::mkdirRecursivelyIfNotExists(unityPath)) {
+			printf("Error: Unable to create folder %s\n", unityPath.value());
+			return false;
+		};
+
+		for (k = 0; k < srcFiles.length(); ++k) {
+			Source source;
+			source.fileName = FileSystem::absolutePath(srcFiles[k]);
+			source.size = 0;
+			if (!FileSystem::getFileSize(srcFiles[k], source.size)) {
+				printf("Error: Source file not found %s\n", srcFiles[k].value());
+				return false;
+			};
+			source.lastWriteTime = 0;
+			FileSystem::getLastWriteTime(srcFiles[k], source.lastWriteTime);
+			source.order = k;
+			source.batch = -1;
+			source.detached = false;
+			sources.push(source);
+		};
+
+		hasManifest = readManifest(manifestFile, storedBatchSize, storedMode, assignment);
+
+		// Edited sources are compiled standalone until stable again
+		if (hasManifest && stableTime > 0) {
+			for (k = 0; k < sources.length(); ++k) {
+				bool isRecent = (now - sources[k].lastWriteTime) < stableTime;
+				if (!assignment.get(sources[k].fileName, entry)) {
+					sources[k].detached = isRecent;
+					continue;
+				};
+				if (entry.lastWriteTime != sources[k].lastWriteTime) {
+					sources[k].detached = true;
+					continue;
+				};
+				sources[k].detached = entry.detached && isRecent;
+			};
+		};
+
+		// Keep previous assignment, only new files are placed
+		if (hasManifest && storedBatchSize == batchSize && storedMode == mode) {
+			for (k = 0; k < sources.length(); ++k) {
+				if (!assignment.get(sources[k].fileName, entry) || entry.batch < 0) {
+					continue;
+				};
+				int index = entry.batch;
+				while (batches.length() <= (size_t)index) {
+					addBatch(batches);
+				};
+				if (batches[index].count >= batchSize) {
+					continue;
+				};
+				sources[k].batch = index;
+				batches[index].size += sources[k].size;
+				batches[index].count++;
+			};
+		};
+
+		if (isIncludeMode) {
+			for (k = 0; k < incPath.length(); ++k) {
+				includeScan.incPath.push(incPath[k].replace("\\", "/"));
+			};
+			for (k = 0; k < sources.length(); ++k) {
+				include[k] = TMemory<IncludeList>::newMemory();
+				includeScan.closure(sources[k].fileName, *include[k]);
+			};
+		};
+
+		for (k = 0; k < sources.length(); ++k) {
+			if (sources[k].batch < 0) {
+				pending.push(k);
+			};
+		};
+
+		if (isIncludeMode && !pending.isEmpty()) {
+			if (batches.isEmpty()) {
+				clusterByInclude(sources, pending, include, includeScan.headerSize, batches, batchSize);
+			} else {
+				for (k = 0; k < pending.length(); ++k) {
+					assignBatchByInclude(pending[k], sources, include, includeScan.headerSize, batches, batchSize);
+				};
+			};
+			pending.empty();
+		};
+
+		if (batches.isEmpty()) {
+			size_t numberOfBatches = (sources.length() + batchSize - 1) / batchSize;
+			for (k = 0; k < numberOfBatches; ++k) {
+				addBatch(batches);
+			};
+		};
+
+		// Largest first, into the lightest batch with room
+		largestFirst(sources, pending);
+		for (k = 0; k < pending.length(); ++k) {
+			assignBatch(sources[pending[k]], batches, batchSize);
+		};
+
+		String manifest;
+		char buffer[64];
+		snprintf(buffer, sizeof(buffer), "%d ", (int)batchSize);
+		manifest << buffer << mode << "\n";
+		for (k = 0; k < sources.length(); ++k) {
+			snprintf(buffer, sizeof(buffer), "%d\t%lld\t%d\t", sources[k].batch, (long long)sources[k].lastWriteTime, sources[k].detached ? 1 : 0);
+			manifest << buffer << sources[k].fileName << "\n";
+		};
+		String oldManifest;
+		if (!Shell::fileGetContents(manifestFile, oldManifest) || oldManifest != manifest) {
+			if (!Shell::filePutContents(manifestFile, manifest)) {
+				printf("Error: Unable to write %s\n", manifestFile.value());
+				return false;
+			};
+		};
+
+		size_t numberOfUnits = 0;
+		for (m = 0; m < batches.length(); ++m) {
+			String unityFile = unityPath + "/" + projectName + ".unity." + NumberX::leftPadByDigits((int)m, 4) + ".cpp";
+			String content;
+			TDynamicArray<String> members;
+			content << "// Generated by xyo-cc, do not edit\n";
+			for (k = 0; k < sources.length(); ++k) {
+				if (sources[k].batch != (int)m || sources[k].detached) {
+					continue;
+				};
+				content << "#include \"" << sources[k].fileName << "\"\n";
+				members.push(srcFiles[sources[k].order]);
+			};
+			// All members detached, nothing to compile
+			if (members.isEmpty()) {
+				continue;
+			};
+
+			String oldContent;
+			if (!Shell::fileGetContents(unityFile, oldContent) || oldContent != content) {
+				if (!Shell::filePutContents(unityFile, content)) {
+					printf("Error: Unable to write %s\n", unityFile.value());
+					return false;
+				};
+			} else if (Shell::isChanged(unityFile, members)) {
+				// Dependency is tracked per original source
+				Shell::touchIfExists(unityFile);
+			};
+
+			unityFiles.push(unityFile);
+			++numberOfUnits;
+		};
+
+		for (k = 0; k < sources.length(); ++k) {
+			if (sources[k].detached) {
+				unityFiles.push(srcFiles[k]);
+				++numberOfDetached;
+			};
+		};
+
+		if (echoCmd && isIncludeMode) {
+			TDynamicArray<Source> sizeBatching;
+			TDynamicArray<Batch> sizeBatches;
+			for (k = 0; k < (sources.length() + batchSize - 1) / batchSize; ++k) {
+				addBatch(sizeBatches);
+			};
+			pending.empty();
+			for (k = 0; k < sources.length(); ++k) {
+				sizeBatching[k] = sources[k];
+				sizeBatching[k].batch = -1;
+				pending.push(k);
+			};
+			largestFirst(sizeBatching, pending);
+			for (k = 0; k < pending.length(); ++k) {
+				assignBatch(sizeBatching[pending[k]], sizeBatches, batchSize);
+			};
+			uint64_t includeParsed = parsedBytes(sources, include, includeScan.headerSize);
+			uint64_t sizeParsed = parsedBytes(sizeBatching, include, includeScan.headerSize);
+			for (k = 0; k < sizeBatching.length(); ++k) {
+				sizeBatching[k].batch = -1;
+			};
+			uint64_t standaloneParsed = parsedBytes(sizeBatching, include, includeScan.headerSize);
+			printf("[unity] estimated parsed bytes %llu, size batching %llu (saved %lld), standalone %llu\n",
+			       (unsigned long long)includeParsed,
+			       (unsigned long long)sizeParsed,
+			       (long long)sizeParsed - (long long)includeParsed,
+			       (unsigned long long)standaloneParsed);
+		};
+
+		if (echoCmd) {
+			printf("[unity] %d sources in %d units, %d standalone\n", (int)sources.length(), (int)numberOfUnits, (int)numberOfDetached);
+		};
+
+		return true;
+	};
+
+};
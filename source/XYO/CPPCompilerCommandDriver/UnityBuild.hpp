@@ -0,0 +1,39 @@
+// C++ Compiler Command Driver
+// Copyright (c) 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// MIT License (MIT) <http://opensource.org/licenses/MIT>
+// SPDX-FileCopyrightText: 2020-2026 Grigore Stefan <g_stefan@yahoo.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_UNITYBUILD_HPP
+#define XYO_CPPCOMPILERCOMMANDDRIVER_UNITYBUILD_HPP
+
+#ifndef XYO_CPPCOMPILERCOMMANDDRIVER_DEPENDENCY_HPP
+#	include <XYO/CPPCompilerCommandDriver/Dependency.hpp>
+#endif
+
+namespace XYO::CPPCompilerCommandDriver {
+
+	// Generate unity translation units from a list of sources,
+	// batches are balanced by file size and kept stable between runs,
+	// sources edited in the last stableTime seconds are left standalone,
+	// mode "include" clusters sources by shared include bytes
+	class UnityBuild : public virtual Object {
+			XYO_PLATFORM_DISALLOW_COPY_ASSIGN_MOVE(UnityBuild);
+
+		public:
+			String projectName;
+			String tmpPath;
+			size_t batchSize;
+			int64_t stableTime;
+			String mode;
+			TDynamicArray<String> incPath;
+			bool echoCmd;
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT UnityBuild();
+
+			XYO_CPPCOMPILERCOMMANDDRIVER_EXPORT bool generate(TDynamicArray<String> &srcFiles, TDynamicArray<String> &unityFiles);
+	};
+
+};
+
+#endif